@@ -0,0 +1,83 @@
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include "annealing.h"
+#include "local_search.h"
+#include "moves.h"
+
+void AnnealingStrategy::run(SolverContext& context) {
+    const SolverOptions& options = context.options;
+    if (!run_initial_strategy(context, "annealing")) {
+        return;
+    }
+    if (options.initial_temperature <= 0.0 || options.final_temperature <= 0.0) {
+        std::cerr << "Annealing temperatures must be positive" << std::endl;
+        return;
+    }
+
+    std::vector<std::unique_ptr<SteinerStrategy>> owned = make_placements(context);
+    std::vector<SteinerStrategy*> placements;
+    for (const auto& placement : owned) {
+        placements.push_back(placement.get());
+    }
+    LocalMoves moves(context, placements);
+    std::mt19937 rng(options.seed);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+    auto energy = [&] { return moves.obtuse_faces() * options.obtuse_weight + moves.steiner_points(); };
+    double budget = optimizer_budget(options);
+    double cooling = std::log(options.final_temperature / options.initial_temperature);
+    double temperature = options.initial_temperature;
+
+    // Copying the triangulation is linear, so saves are rate-limited: a state below the saved energy is
+    // saved when it is reached, unless the last save is less than 1% of the budget old; then it is saved
+    // at the first clock check that is past that delay and still finds the energy below the saved one
+    CDT best = context.cdt;
+    int saved_energy = energy();
+    double save_interval = budget / 100;
+    double last_save = -save_interval;
+    double elapsed = 0.0;
+    auto save = [&] {
+        best = context.cdt;
+        saved_energy = energy();
+        last_save = elapsed;
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t step = 0; energy() > 0; ++step) {
+        // Update the clock and the temperature every few moves only
+        if (step % 64 == 0) {
+            elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            if (elapsed >= budget || (options.should_stop && options.should_stop(moves.steiner_points()))) {
+                break;
+            }
+            temperature = options.initial_temperature * std::exp(cooling * elapsed / budget);
+            if (energy() < saved_energy && elapsed - last_save >= save_interval) {
+                save();
+            }
+        }
+
+        MoveDelta delta = moves.random_move(rng);
+        if (!delta.applied) {
+            continue;
+        }
+        context.result.moves_tried++;
+        int cost = move_cost(delta, options.obtuse_weight);
+        if (cost <= 0 || uniform(rng) < std::exp(-cost / temperature)) {
+            context.result.moves_accepted++;
+            if (energy() < saved_energy && elapsed - last_save >= save_interval) {
+                save();
+            }
+        } else {
+            moves.undo();
+        }
+    }
+
+    if (saved_energy < energy()) {
+        context.cdt = best;
+    }
+}
+
+// Register the strategy under its command line name
+static bool registered = register_strategy("annealing", [] { return std::unique_ptr<Strategy>(new AnnealingStrategy()); });
@@ -0,0 +1,22 @@
+#ifndef ANNEALING_H
+#define ANNEALING_H
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include "strategy.h"
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel K;
+typedef CDT DT;
+typedef DT::Point Point;
+
+// Simulated annealing over the local moves, starting from a greedy solution (options.initial_strategy)
+// Energy: obtuse faces * options.obtuse_weight + Steiner points, updated from the faces each move touches.
+// A move that raises the energy by d is kept with probability exp(-d / T); the temperature T cools
+// geometrically from options.initial_temperature to options.final_temperature over the time budget.
+// The run ends with the lower-energy one of the final triangulation and the last saved one; a new low
+// is saved when it is reached, but at most once per 1% of the budget (see run()).
+class AnnealingStrategy : public Strategy {
+public:
+    void run(SolverContext& context) override;
+};
+
+#endif
@@ -0,0 +1,175 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <thread>
+#include "ant_colony.h"
+#include "local_search.h"
+#include "obtuse.h"
+#include "steiner.h"
+
+namespace {
+
+const int REGIONS_PER_SIDE = 8;        // the bounding box is cut into REGIONS_PER_SIDE^2 regions
+const double EVAPORATION = 0.1;        // share of the pheromone lost after each generation
+const double MIN_PHEROMONE = 0.01;     // floor that keeps every placement possible
+
+// Function to add to an atomic double without a lock
+void atomic_add(std::atomic<double>& target, double value) {
+    double current = target.load(std::memory_order_relaxed);
+    while (!target.compare_exchange_weak(current, current + value, std::memory_order_relaxed)) {
+    }
+}
+
+// Pheromone levels of the colony, one per (region, placement) pair
+struct Pheromones {
+    double min_x = 0.0, min_y = 0.0, cell_width = 1.0, cell_height = 1.0;
+    std::size_t placements = 0;
+    std::vector<double> levels;                       // read by the ants during a generation
+    std::unique_ptr<std::atomic<double>[]> deposits;  // written by the ants during a generation
+
+    Pheromones(const std::vector<Point>& points, std::size_t placements) : placements(placements) {
+        double max_x = min_x, max_y = min_y;
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            double x = CGAL::to_double(points[i].x()), y = CGAL::to_double(points[i].y());
+            min_x = i == 0 ? x : std::min(min_x, x);
+            min_y = i == 0 ? y : std::min(min_y, y);
+            max_x = i == 0 ? x : std::max(max_x, x);
+            max_y = i == 0 ? y : std::max(max_y, y);
+        }
+        cell_width = std::max(max_x - min_x, 1e-9) / REGIONS_PER_SIDE;
+        cell_height = std::max(max_y - min_y, 1e-9) / REGIONS_PER_SIDE;
+
+        std::size_t size = REGIONS_PER_SIDE * REGIONS_PER_SIDE * placements;
+        levels.assign(size, 1.0);
+        deposits.reset(new std::atomic<double>[size]);
+        for (std::size_t i = 0; i < size; ++i) {
+            deposits[i].store(0.0);
+        }
+    }
+
+    // Function to get the region of a face, from the cell of its centroid
+    int region(CDT::Face_handle face) const {
+        double x = 0.0, y = 0.0;
+        for (int i = 0; i < 3; ++i) {
+            x += CGAL::to_double(face->vertex(i)->point().x()) / 3;
+            y += CGAL::to_double(face->vertex(i)->point().y()) / 3;
+        }
+        int column = std::min(std::max(static_cast<int>((x - min_x) / cell_width), 0), REGIONS_PER_SIDE - 1);
+        int row = std::min(std::max(static_cast<int>((y - min_y) / cell_height), 0), REGIONS_PER_SIDE - 1);
+        return row * REGIONS_PER_SIDE + column;
+    }
+
+    // Function to end a generation: evaporate, then merge the deposits of the ants
+    void update() {
+        for (std::size_t i = 0; i < levels.size(); ++i) {
+            levels[i] = std::max((1.0 - EVAPORATION) * levels[i] + deposits[i].exchange(0.0), MIN_PHEROMONE);
+        }
+    }
+};
+
+// One ant: a Steiner strategy that draws the placement of each face from the pheromones
+class Ant : public SteinerStrategy {
+public:
+    Ant(const SolverContext& context, const Pheromones& pheromones, unsigned int seed)
+        : placements(make_placements(context)), pheromones(pheromones), rng(seed) {}
+
+    bool candidate(const CDT& cdt, CDT::Face_handle face, int obtuse_vertex, CDT::Point& steiner) override {
+        if (placements.empty()) {
+            return false;
+        }
+        int region = pheromones.region(face);
+        const double* levels = &pheromones.levels[region * pheromones.placements];
+        std::discrete_distribution<std::size_t> choice(levels, levels + placements.size());
+        chosen = choice(rng);
+        used.push_back(region * pheromones.placements + chosen);
+        return placements[chosen]->candidate(cdt, face, obtuse_vertex, steiner);
+    }
+
+    bool accept(const CDT& cdt, CDT::Face_handle face, int obtuse_vertex, const CDT::Point& steiner) override {
+        return placements[chosen]->accept(cdt, face, obtuse_vertex, steiner);
+    }
+
+    // Pairs chosen by the ant, one entry per choice
+    std::vector<std::size_t> used;
+
+private:
+    std::vector<std::unique_ptr<SteinerStrategy>> placements;
+    const Pheromones& pheromones;
+    std::mt19937 rng;
+    std::size_t chosen = 0;
+};
+
+}  // namespace
+
+void AntColonyStrategy::run(SolverContext& context) {
+    const SolverOptions& options = context.options;
+    unsigned int ants = options.jobs != 0 ? options.jobs : std::max(1u, std::thread::hardware_concurrency());
+    Pheromones pheromones(context.input.points, make_placements(context).size());
+    if (pheromones.placements == 0) {
+        return;
+    }
+
+    // Energy of a solution, as for the other optimizers; the unrefined triangulation is the reference
+    int base_vertices = static_cast<int>(context.cdt.number_of_vertices());
+    int base_energy = count_obtuse_faces(context.cdt) * options.obtuse_weight;
+
+    std::mutex best_mutex;
+    CDT best;
+    int best_energy = base_energy;
+    bool found = false;
+    SolverResult best_stats;
+
+    double budget = optimizer_budget(options);
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int generation = 0;; ++generation) {
+        double remaining = budget - std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (remaining <= 0.0 || (found && options.should_stop && options.should_stop(best.number_of_vertices() - base_vertices))) {
+            break;
+        }
+        SolverOptions ant_options = options;
+        ant_options.time_limit = remaining;
+
+        // Each ant copies the unrefined triangulation, which is only read during the generation
+        auto run_ant = [&](unsigned int index) {
+            CDT cdt = context.cdt;
+            SolverResult stats;
+            Ant ant(context, pheromones, options.seed + generation * ants + index);
+            refine_obtuse_faces(cdt, ant, ant_options, stats);
+
+            int energy = count_obtuse_faces(cdt) * options.obtuse_weight +
+                         static_cast<int>(cdt.number_of_vertices()) - base_vertices;
+            double deposit = static_cast<double>(base_energy + 1) / (energy + 1) / std::max<std::size_t>(ant.used.size(), 1);
+            for (std::size_t pair : ant.used) {
+                atomic_add(pheromones.deposits[pair], deposit);
+            }
+
+            std::lock_guard<std::mutex> lock(best_mutex);
+            if (!found || energy < best_energy) {
+                best = std::move(cdt);
+                best_energy = energy;
+                best_stats = stats;
+                found = true;
+            }
+        };
+
+        std::vector<std::thread> colony;
+        for (unsigned int index = 0; index < ants; ++index) {
+            colony.emplace_back(run_ant, index);
+        }
+        for (std::thread& ant : colony) {
+            ant.join();
+        }
+        pheromones.update();
+    }
+
+    if (found) {
+        context.cdt = std::move(best);
+        context.result.faces_examined = best_stats.faces_examined;
+        context.result.rejected_candidates = best_stats.rejected_candidates;
+    }
+}
+
+// Register the strategy under its command line name
+static bool registered = register_strategy("ant-colony", [] { return std::unique_ptr<Strategy>(new AntColonyStrategy()); });
@@ -0,0 +1,23 @@
+#ifndef ANT_COLONY_H
+#define ANT_COLONY_H
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include "strategy.h"
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel K;
+typedef CDT DT;
+typedef DT::Point Point;
+
+// Ant colony optimization over the placement rules
+// The bounding box of the instance is cut into regions; each (region, placement) pair has a pheromone
+// level. An ant refines its own copy of the triangulation, choosing for each obtuse face one placement
+// with probability proportional to the pheromone of the face's region. The ants of a generation run
+// in parallel (options.jobs threads, 0 for one per hardware thread) and deposit pheromone on the pairs
+// they used in proportion to their solution's quality; generations repeat until the time budget runs
+// out and the best solution found is kept.
+class AntColonyStrategy : public Strategy {
+public:
+    void run(SolverContext& context) override;
+};
+
+#endif
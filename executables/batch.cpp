@@ -0,0 +1,177 @@
+#include <boost/filesystem.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+#include "batch.h"
+#include "inputs.h"
+#include "solver.h"
+
+namespace fs = boost::filesystem;
+
+// Outcome of one instance of the batch
+struct BatchEntry {
+    std::string name;  // unique among the entries, names the solution file and the summary row
+    std::string instance_path;
+    std::string solution_path;
+    SolverResult result;
+    double seconds = 0.0;
+    bool solved = false;
+};
+
+// Function to list the instance files of a directory (sorted) or of a manifest file
+// Manifest paths are relative to the manifest's directory, blank lines and lines starting with # are skipped
+static std::vector<std::string> list_instances(const std::string& batch_path) {
+    std::vector<std::string> instances;
+    fs::path root(batch_path);
+
+    if (fs::is_directory(root)) {
+        for (const auto& entry : fs::directory_iterator(root)) {
+            if (fs::is_regular_file(entry.path()) && entry.path().extension() == ".json") {
+                instances.push_back(entry.path().string());
+            }
+        }
+        std::sort(instances.begin(), instances.end());
+        return instances;
+    }
+
+    std::ifstream manifest(batch_path);
+    if (!manifest) {
+        std::cerr << "Error opening batch manifest: " << batch_path << std::endl;
+        return instances;
+    }
+    std::string line;
+    while (std::getline(manifest, line)) {
+        line.erase(0, line.find_first_not_of(" \t\r"));
+        line.erase(line.find_last_not_of(" \t\r") + 1);
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        fs::path instance(line);
+        if (instance.is_relative()) {
+            instance = root.parent_path() / instance;
+        }
+        instances.push_back(instance.string());
+    }
+    return instances;
+}
+
+// Function to name the instances by their file stems
+// Instances whose stems collide (same file name in different directories, or a path listed twice) are
+// prefixed with their directory name, then numbered in order if that is not enough
+static std::vector<std::string> instance_names(const std::vector<std::string>& instances) {
+    std::vector<std::string> names;
+    std::map<std::string, int> stem_count;
+    for (const std::string& instance : instances) {
+        names.push_back(fs::path(instance).stem().string());
+        stem_count[names.back()]++;
+    }
+    for (std::size_t i = 0; i < instances.size(); ++i) {
+        if (stem_count[names[i]] > 1) {
+            fs::path directory = fs::path(instances[i]).parent_path();
+            names[i] = (directory.empty() ? std::string(".") : directory.filename().string()) + "_" + names[i];
+        }
+    }
+    std::map<std::string, int> name_count, seen;
+    for (const std::string& name : names) {
+        name_count[name]++;
+    }
+    for (std::string& name : names) {
+        if (name_count[name] > 1) {
+            name += "_" + std::to_string(++seen[name]);
+        }
+    }
+    return names;
+}
+
+int run_batch(const SolverOptions& options) {
+    if (options.strategy.empty()) {
+        std::cerr << "Batch mode needs --strategy" << std::endl;
+        return 1;
+    }
+
+    std::vector<std::string> instances = list_instances(options.batch_path);
+    if (instances.empty()) {
+        std::cerr << "No instances found in " << options.batch_path << std::endl;
+        return 1;
+    }
+
+    boost::system::error_code error;
+    fs::create_directories(options.output_dir, error);
+    if (error) {
+        std::cerr << "Error creating output directory " << options.output_dir << ": " << error.message() << std::endl;
+        return 1;
+    }
+
+    std::vector<std::string> names = instance_names(instances);
+    std::vector<BatchEntry> entries(instances.size());
+    for (std::size_t i = 0; i < instances.size(); ++i) {
+        entries[i].name = names[i];
+        entries[i].instance_path = instances[i];
+        entries[i].solution_path = (fs::path(options.output_dir) / (names[i] + ".solution.json")).string();
+    }
+
+    unsigned int jobs = options.jobs != 0 ? options.jobs : std::max(1u, std::thread::hardware_concurrency());
+    jobs = std::min<unsigned int>(jobs, static_cast<unsigned int>(entries.size()));
+
+    // Fixed-size pool: each worker takes the next unsolved instance until none is left
+    std::atomic<std::size_t> next_entry(0);
+    auto worker = [&]() {
+        for (std::size_t i = next_entry++; i < entries.size(); i = next_entry++) {
+            BatchEntry& entry = entries[i];
+
+            SolverOptions instance_options = options;
+            instance_options.input_path = entry.instance_path;
+            instance_options.output_path = entry.solution_path;
+            instance_options.draw = false;
+
+            auto start = std::chrono::steady_clock::now();
+            try {
+                InputData input = inputs(entry.instance_path);
+                entry.solved = solve_instance(input, instance_options, entry.result);
+            } catch (const std::exception& e) {
+                std::cerr << "Error solving " << entry.instance_path << ": " << e.what() << std::endl;
+                entry.solved = false;
+            }
+            entry.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned int j = 0; j < jobs; ++j) {
+        pool.emplace_back(worker);
+    }
+    for (std::thread& thread : pool) {
+        thread.join();
+    }
+
+    // Summary table, on the console and as CSV
+    std::string summary_path = (fs::path(options.output_dir) / "summary.csv").string();
+    std::ofstream summary(summary_path);
+    summary << "instance,solved,steiner_points,obtuse_faces,seconds\n";
+
+    std::cout << std::left << std::setw(40) << "instance" << std::right
+              << std::setw(8) << "solved" << std::setw(10) << "steiner" << std::setw(10) << "obtuse" << std::setw(12) << "seconds" << "\n";
+    int failures = 0;
+    for (const BatchEntry& entry : entries) {
+        const std::string& name = entry.name;
+        if (!entry.solved) {
+            failures++;
+        }
+        summary << name << "," << (entry.solved ? "yes" : "no") << "," << entry.result.steiner_points << ","
+                << entry.result.obtuse_faces << "," << std::fixed << std::setprecision(3) << entry.seconds << "\n";
+        std::cout << std::left << std::setw(40) << name << std::right
+                  << std::setw(8) << (entry.solved ? "yes" : "no") << std::setw(10) << entry.result.steiner_points
+                  << std::setw(10) << entry.result.obtuse_faces << std::setw(12) << std::fixed << std::setprecision(3) << entry.seconds << "\n";
+    }
+    std::cout << "Summary written to " << summary_path << std::endl;
+
+    return failures == 0 ? 0 : 1;
+}
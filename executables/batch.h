@@ -0,0 +1,13 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include "options.h"
+
+// Solves every instance listed by options.batch_path (a directory of .json files or a manifest
+// with one path per line) on options.jobs worker threads, each with its own triangulation.
+// Writes <output_dir>/<instance>.solution.json per instance plus <output_dir>/summary.csv.
+// <instance> is the file stem, prefixed with the directory name when two instances share a stem.
+// Returns the process exit code: 0 if every instance was solved.
+int run_batch(const SolverOptions& options);
+
+#endif
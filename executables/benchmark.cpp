@@ -0,0 +1,398 @@
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+#include <sys/resource.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "inputs.h"
+#include "options.h"
+#include "solver.h"
+
+// Benchmark for the solver strategies.
+// Instances are generated in memory (random point sets inside their convex hull and random
+// star-shaped polygons with interior points, each with and without additional constraints) or read
+// from CG:SHOP files. Every (instance, strategy) run is done in a forked child that generates or reads
+// its instance itself, so the wall time and peak RSS reported are those of that run alone (the parent
+// only holds the instance descriptions). One JSON object is written per run.
+
+namespace fs = boost::filesystem;
+namespace po = boost::program_options;
+
+typedef std::pair<long long, long long> IntPoint;
+
+// Settings of a benchmark session
+struct BenchmarkOptions {
+    std::vector<int> sizes = {100, 1000, 10000, 100000};
+    std::vector<std::string> strategies = {"center", "projection", "circumcenter", "convex-centroid", "centroid", "flip", "best"};
+    std::vector<std::string> families = {"points", "polygon"};
+    std::vector<std::string> instance_paths;
+    std::string output_path;  // JSON lines, stdout if empty
+    std::string output_dir;   // solutions are discarded if empty
+    std::size_t max_steiner = 10000;
+    double time_limit = 0.0;
+    unsigned int seed = 0;
+    bool fast = false;
+};
+
+// Description of one benchmark instance: a generated family, or a CG:SHOP file
+struct BenchmarkInstance {
+    std::string family;  // "points", "polygon" or "file"
+    int size = 0;
+    bool constrained = false;
+    std::string path;    // file instances only
+};
+
+// Measurements of one run, sent from the child back to the parent through a pipe
+struct RunReport {
+    int loaded = 0;
+    int solved = 0;
+    double seconds = 0.0;
+    long long points = 0;
+    long long constraints = 0;
+    long long steiner_points = 0;
+    long long obtuse_faces = 0;
+    char instance_uid[128] = {};
+};
+
+// Function to compute the convex hull of integer points (Andrew's monotone chain), as indices in counterclockwise order
+static std::vector<int> convex_hull_indices(const std::vector<IntPoint>& points) {
+    std::vector<int> order(points.size());
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        order[i] = static_cast<int>(i);
+    }
+    std::sort(order.begin(), order.end(), [&](int a, int b) { return points[a] < points[b]; });
+    auto cross = [&](int o, int a, int b) {
+        return (points[a].first - points[o].first) * (points[b].second - points[o].second) -
+               (points[a].second - points[o].second) * (points[b].first - points[o].first);
+    };
+
+    std::vector<int> hull(2 * order.size());
+    std::size_t k = 0;
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        while (k >= 2 && cross(hull[k - 2], hull[k - 1], order[i]) <= 0) {
+            k--;
+        }
+        hull[k++] = order[i];
+    }
+    for (std::size_t i = order.size() - 1, lower = k + 1; i > 0; --i) {
+        while (k >= lower && cross(hull[k - 2], hull[k - 1], order[i - 1]) <= 0) {
+            k--;
+        }
+        hull[k++] = order[i - 1];
+    }
+    hull.resize(k - 1);
+    return hull;
+}
+
+// Function to generate the integer points of an instance family
+// "points": uniform points in a square, bounded by their convex hull
+// "polygon": a random star-shaped polygon around the origin with a quarter of the points on the
+// boundary and the rest strictly inside it
+// The origin is always point 0 so that constraints can be drawn from it
+static void generate_points(const std::string& family, int size, std::mt19937_64& rng,
+                            std::vector<IntPoint>& points, std::vector<int>& boundary) {
+    const long long range = 1000000;
+    std::uniform_int_distribution<long long> coordinate(-range, range);
+    std::vector<IntPoint> unique;
+    points.assign(1, IntPoint(0, 0));
+
+    if (family == "points") {
+        while (static_cast<int>(points.size()) < size) {
+            points.emplace_back(coordinate(rng), coordinate(rng));
+        }
+        unique = points;
+        std::sort(unique.begin() + 1, unique.end());
+        unique.erase(std::unique(unique.begin() + 1, unique.end()), unique.end());
+        unique.erase(std::remove(unique.begin() + 1, unique.end(), IntPoint(0, 0)), unique.end());
+        points = unique;
+        boundary = convex_hull_indices(points);
+        return;
+    }
+
+    // Boundary vertices in angular order around the origin, one per direction
+    int boundary_size = std::max(3, size / 4);
+    std::uniform_real_distribution<double> radius(0.5, 1.0);
+    std::uniform_real_distribution<double> angle(0.0, 2.0 * M_PI);
+    std::vector<IntPoint> vertices;
+    while (static_cast<int>(vertices.size()) < boundary_size) {
+        double a = angle(rng), r = radius(rng) * range;
+        IntPoint p(std::llround(r * std::cos(a)), std::llround(r * std::sin(a)));
+        if (p != IntPoint(0, 0)) {
+            vertices.push_back(p);
+        }
+    }
+    auto half = [](const IntPoint& p) { return p.second > 0 || (p.second == 0 && p.first > 0) ? 0 : 1; };
+    auto before = [&](const IntPoint& a, const IntPoint& b) {
+        if (half(a) != half(b)) {
+            return half(a) < half(b);
+        }
+        return a.first * b.second - a.second * b.first > 0;
+    };
+    auto same_direction = [&](const IntPoint& a, const IntPoint& b) { return !before(a, b) && !before(b, a); };
+    std::sort(vertices.begin(), vertices.end(), before);
+    vertices.erase(std::unique(vertices.begin(), vertices.end(), same_direction), vertices.end());
+
+    // The polygon contains the disk of radius min_radius * cos(max_gap / 2) around the origin
+    double min_radius = range, max_gap = 0.0;
+    for (std::size_t i = 0; i < vertices.size(); ++i) {
+        const IntPoint& p = vertices[i];
+        const IntPoint& q = vertices[(i + 1) % vertices.size()];
+        min_radius = std::min(min_radius, std::hypot(static_cast<double>(p.first), static_cast<double>(p.second)));
+        double gap = std::atan2(static_cast<double>(q.second), static_cast<double>(q.first)) -
+                     std::atan2(static_cast<double>(p.second), static_cast<double>(p.first));
+        if (gap <= 0.0) {
+            gap += 2.0 * M_PI;
+        }
+        max_gap = std::max(max_gap, gap);
+    }
+    double inner_radius = max_gap < M_PI ? 0.9 * min_radius * std::cos(max_gap / 2.0) - 1.0 : 0.0;
+
+    for (const IntPoint& p : vertices) {
+        boundary.push_back(static_cast<int>(points.size()));
+        points.push_back(p);
+    }
+    std::vector<IntPoint> interior;
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    int interior_size = inner_radius > 1.0 ? size - static_cast<int>(points.size()) : 0;
+    while (static_cast<int>(interior.size()) < interior_size) {
+        double a = angle(rng), r = std::sqrt(unit(rng)) * inner_radius;
+        IntPoint p(std::llround(r * std::cos(a)), std::llround(r * std::sin(a)));
+        if (p != IntPoint(0, 0)) {
+            interior.push_back(p);
+        }
+    }
+    std::sort(interior.begin(), interior.end());
+    interior.erase(std::unique(interior.begin(), interior.end()), interior.end());
+    points.insert(points.end(), interior.begin(), interior.end());
+}
+
+// Function to generate an instance: the constraints, if requested, join the origin to every k-th
+// boundary vertex; the region is star-shaped from the origin, so they never cross each other or the boundary
+static InputData generate_instance(const std::string& family, int size, bool constrained, unsigned int seed) {
+    InputData input;
+    std::mt19937_64 rng(seed * 1000003ULL + static_cast<unsigned long long>(size) * 2 + (family == "polygon" ? 1 : 0));
+    std::vector<IntPoint> points;
+    generate_points(family, size, rng, points, input.region_boundary);
+
+    input.instance_uid = family + "_" + std::to_string(size) + (constrained ? "_constrained" : "");
+    for (const IntPoint& p : points) {
+        input.points.emplace_back(static_cast<double>(p.first), static_cast<double>(p.second));
+    }
+    if (constrained) {
+        const std::vector<int>& boundary = input.region_boundary;
+        std::size_t step = std::max<std::size_t>(1, boundary.size() / 8);
+        for (std::size_t i = 0; i < boundary.size(); i += step) {
+            input.additional_constraints.push_back({0, boundary[i]});
+        }
+    }
+    return input;
+}
+
+// Function to build the input of an instance, in the process that solves it
+// Returns false if the instance has no points (an unreadable file)
+static bool load_instance(const BenchmarkInstance& instance, unsigned int seed, InputData& input) {
+    if (instance.family != "file") {
+        input = generate_instance(instance.family, instance.size, instance.constrained, seed);
+        return true;
+    }
+    input = inputs(instance.path);
+    if (input.instance_uid.empty()) {
+        input.instance_uid = fs::path(instance.path).stem().string();
+    }
+    return !input.points.empty();
+}
+
+// Function to name an instance before it is loaded
+static std::string instance_name(const BenchmarkInstance& instance) {
+    if (instance.family == "file") {
+        return fs::path(instance.path).stem().string();
+    }
+    return instance.family + "_" + std::to_string(instance.size) + (instance.constrained ? "_constrained" : "");
+}
+
+// Function to solve one instance with one strategy in a child process
+// The child's stdout is discarded; its report comes back through a pipe and its peak RSS through wait4
+static bool run_in_child(const BenchmarkInstance& instance, const std::string& strategy, const BenchmarkOptions& options,
+                         RunReport& report, long& peak_rss_kb) {
+    int channel[2];
+    if (pipe(channel) != 0) {
+        std::perror("pipe");
+        return false;
+    }
+    std::cout.flush();
+    pid_t child = fork();
+    if (child < 0) {
+        std::perror("fork");
+        return false;
+    }
+
+    if (child == 0) {
+        close(channel[0]);
+        int null_fd = open("/dev/null", O_WRONLY);
+        if (null_fd >= 0) {
+            dup2(null_fd, STDOUT_FILENO);
+        }
+
+        SolverOptions solver_options;
+        solver_options.strategy = strategy;
+        solver_options.max_steiner = options.max_steiner;
+        solver_options.time_limit = options.time_limit;
+        solver_options.seed = options.seed;
+        solver_options.fast = options.fast;
+        solver_options.output_path = "/dev/null";
+
+        RunReport child_report;
+        InputData input;
+        auto start = std::chrono::steady_clock::now();
+        try {
+            child_report.loaded = load_instance(instance, options.seed, input) ? 1 : 0;
+            std::strncpy(child_report.instance_uid, input.instance_uid.c_str(), sizeof(child_report.instance_uid) - 1);
+            child_report.points = static_cast<long long>(input.points.size());
+            child_report.constraints = static_cast<long long>(input.additional_constraints.size());
+            if (!options.output_dir.empty()) {
+                solver_options.output_path = (fs::path(options.output_dir) / (input.instance_uid + "." + strategy + ".solution.json")).string();
+            }
+            SolverResult result;
+            start = std::chrono::steady_clock::now();  // time the solve, not the generation
+            child_report.solved = child_report.loaded && solve_instance(input, solver_options, result) ? 1 : 0;
+            child_report.steiner_points = static_cast<long long>(result.steiner_points);
+            child_report.obtuse_faces = result.obtuse_faces;
+        } catch (const std::exception& e) {
+            std::cerr << "Error solving " << instance_name(instance) << " with " << strategy << ": " << e.what() << std::endl;
+        }
+        child_report.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        ssize_t written = write(channel[1], &child_report, sizeof(child_report));
+        _exit(written == static_cast<ssize_t>(sizeof(child_report)) ? 0 : 1);
+    }
+
+    close(channel[1]);
+    ssize_t received = read(channel[0], &report, sizeof(report));
+    close(channel[0]);
+
+    int status = 0;
+    struct rusage usage;
+    if (wait4(child, &status, 0, &usage) < 0) {
+        std::perror("wait4");
+        return false;
+    }
+    peak_rss_kb = usage.ru_maxrss;  // kilobytes on Linux
+    return received == static_cast<ssize_t>(sizeof(report)) && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+// Function to write one run as a JSON line
+static void write_report(std::ostream& out, const BenchmarkInstance& instance, const std::string& strategy,
+                         bool fast, bool finished, const RunReport& report, long peak_rss_kb) {
+    out << "{\"instance\": \"" << (report.instance_uid[0] != '\0' ? std::string(report.instance_uid) : instance_name(instance)) << "\""
+        << ", \"family\": \"" << instance.family << "\""
+        << ", \"size\": " << report.points
+        << ", \"constraints\": " << report.constraints
+        << ", \"strategy\": \"" << strategy << "\""
+        << ", \"fast\": " << (fast ? "true" : "false")
+        << ", \"status\": \"" << (!finished ? "crashed" : !report.loaded ? "unreadable" : report.solved ? "ok" : "failed") << "\""
+        << ", \"seconds\": " << report.seconds
+        << ", \"peak_rss_kb\": " << peak_rss_kb
+        << ", \"steiner_points\": " << report.steiner_points
+        << ", \"obtuse_faces\": " << report.obtuse_faces << "}" << std::endl;
+}
+
+static bool parse_benchmark_options(int argc, char* argv[], BenchmarkOptions& options) {
+    po::options_description description("Benchmark options");
+    description.add_options()
+        ("help,h", "show this message")
+        ("sizes", po::value<std::vector<int>>(&options.sizes)->multitoken(), "number of points of the generated instances (default 100 1000 10000 100000)")
+        ("families", po::value<std::vector<std::string>>(&options.families)->multitoken(), "generated instance families: points, polygon (default both)")
+        ("strategies", po::value<std::vector<std::string>>(&options.strategies)->multitoken(), "strategies to run (default all)")
+        ("instance", po::value<std::vector<std::string>>(&options.instance_paths), "also run a CG:SHOP instance file (repeatable)")
+        ("output,o", po::value<std::string>(&options.output_path), "JSON lines report file (default stdout)")
+        ("output-dir", po::value<std::string>(&options.output_dir), "keep the solutions in this directory")
+        ("max-steiner", po::value<std::size_t>(&options.max_steiner)->default_value(options.max_steiner), "maximum number of Steiner points per run")
+        ("time-limit", po::value<double>(&options.time_limit)->default_value(options.time_limit), "time limit per run in seconds, 0 for none")
+        ("seed", po::value<unsigned int>(&options.seed)->default_value(options.seed), "seed of the instance generator and the solver")
+        ("fast", po::bool_switch(&options.fast), "run the solver in fast mode (dyadic snapping, exact validation at the end)");
+
+    po::variables_map vm;
+    try {
+        po::store(po::parse_command_line(argc, argv, description), vm);
+        po::notify(vm);
+    } catch (const po::error& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        std::cerr << description << std::endl;
+        return false;
+    }
+
+    if (vm.count("help")) {
+        std::cout << description << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    BenchmarkOptions options;
+    if (!parse_benchmark_options(argc, argv, options)) {
+        return 1;
+    }
+
+    if (!options.output_dir.empty()) {
+        boost::system::error_code error;
+        fs::create_directories(options.output_dir, error);
+        if (error) {
+            std::cerr << "Error creating output directory " << options.output_dir << ": " << error.message() << std::endl;
+            return 1;
+        }
+    }
+
+    std::ofstream report_file;
+    if (!options.output_path.empty()) {
+        report_file.open(options.output_path);
+        if (!report_file) {
+            std::cerr << "Error opening file: " << options.output_path << std::endl;
+            return 1;
+        }
+    }
+    std::ostream& out = options.output_path.empty() ? std::cout : report_file;
+
+    // Only the descriptions are kept here: each child generates or reads its own instance
+    std::vector<BenchmarkInstance> instances;
+    for (const std::string& family : options.families) {
+        if (family != "points" && family != "polygon") {
+            std::cerr << "Unknown instance family: " << family << std::endl;
+            return 1;
+        }
+        for (int size : options.sizes) {
+            for (bool constrained : {false, true}) {
+                instances.push_back({family, size, constrained, ""});
+            }
+        }
+    }
+    for (const std::string& path : options.instance_paths) {
+        instances.push_back({"file", 0, false, path});
+    }
+
+    int failures = 0;
+    for (const BenchmarkInstance& instance : instances) {
+        for (const std::string& strategy : options.strategies) {
+            RunReport report;
+            long peak_rss_kb = 0;
+            bool finished = run_in_child(instance, strategy, options, report, peak_rss_kb);
+            if (!finished || !report.solved) {
+                failures++;
+            }
+            write_report(out, instance, strategy, options.fast, finished, report, peak_rss_kb);
+        }
+    }
+    return failures == 0 ? 0 : 1;
+}
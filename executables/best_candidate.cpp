@@ -0,0 +1,89 @@
+#include <iterator>
+#include <string>
+#include "best_candidate.h"
+#include "obtuse.h"
+#include "steiner.h"
+
+bool obtuse_faces_removed(const CDT& cdt, CDT::Face_handle start, const Point& p, int& removed) {
+    std::vector<CDT::Face_handle> zone;
+    std::vector<CDT::Edge> boundary;
+    cdt.get_conflicts_and_boundary(p, std::back_inserter(zone), std::back_inserter(boundary), start);
+    if (zone.empty()) {
+        return false;  // p is a vertex
+    }
+
+    removed = 0;
+    for (CDT::Face_handle face : zone) {
+        if (in_domain(cdt, face) && is_obtuse_triangle(face)) {
+            removed++;
+        }
+    }
+
+    // Each boundary edge (g, j) is seen from the face g outside the zone
+    for (const CDT::Edge& edge : boundary) {
+        CDT::Face_handle outside = edge.first;
+        int j = edge.second;
+        CDT::Vertex_handle a = outside->vertex(CDT::cw(j));
+        CDT::Vertex_handle b = outside->vertex(CDT::ccw(j));
+        if (cdt.is_infinite(a) || cdt.is_infinite(b)) {
+            continue;
+        }
+        if (!CGAL::collinear(p, a->point(), b->point())) {
+            // The new face (p, a, b) replaces zone faces, on the same side of every constraint
+            if (in_domain(cdt, outside->neighbor(j)) && is_obtuse_triangle(p, a->point(), b->point())) {
+                removed--;
+            }
+            continue;
+        }
+
+        // p lies on a constrained edge of the zone: the face behind it is split in two as well
+        if (!in_domain(cdt, outside)) {
+            continue;
+        }
+        const Point& c = outside->vertex(j)->point();
+        if (is_obtuse_triangle(outside)) {
+            removed++;
+        }
+        if (is_obtuse_triangle(p, a->point(), c)) {
+            removed--;
+        }
+        if (is_obtuse_triangle(p, c, b->point())) {
+            removed--;
+        }
+    }
+    return true;
+}
+
+void BestCandidateStrategy::prepare(const SolverContext& context) {
+    placements = make_placements(context);
+    options = context.options;
+}
+
+bool BestCandidateStrategy::candidate(const CDT& cdt, CDT::Face_handle face, int obtuse_vertex, CDT::Point& steiner) {
+    bool found = false;
+    int best_removed = 0;
+    for (const auto& placement : placements) {
+        Point p;
+        if (!placement->candidate(cdt, face, obtuse_vertex, p)) {
+            continue;
+        }
+        snap_steiner_point(cdt, face, obtuse_vertex, options, p);
+        if (!placement->accept(cdt, face, obtuse_vertex, p)) {
+            continue;
+        }
+        int removed = 0;
+        if (!obtuse_faces_removed(cdt, face, p, removed)) {
+            continue;
+        }
+        // Ties go to the earlier placement, the cheaper constructions come first
+        if (!found || removed > best_removed) {
+            found = true;
+            best_removed = removed;
+            steiner = p;
+        }
+    }
+    return found;
+}
+
+// Register the strategy under its command line name
+static bool registered = register_strategy("best", [] { return std::unique_ptr<Strategy>(new BestCandidateStrategy()); });
@@ -0,0 +1,31 @@
+#ifndef BEST_CANDIDATE_H
+#define BEST_CANDIDATE_H
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <memory>
+#include <vector>
+#include "strategy.h"
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel K;
+typedef CDT DT;
+typedef DT::Point Point;
+
+// Function to estimate how many obtuse faces the insertion of p would remove (negative if it adds some)
+// Only the conflict zone of p is examined: its faces are replaced by the star of p over the zone's boundary
+// Returns false if p is already a vertex or cannot be inserted
+bool obtuse_faces_removed(const CDT& cdt, CDT::Face_handle start, const Point& p, int& removed);
+
+// Evaluates every Steiner placement (midpoint of the longest edge, projection, circumcenter, centroid
+// and convex polygon centroid) for each obtuse face and keeps the one that removes the most obtuse faces
+// Each candidate is scored as it would be inserted: snapped, and only if its placement accepts it
+class BestCandidateStrategy : public SteinerStrategy {
+public:
+    void prepare(const SolverContext& context) override;
+    bool candidate(const CDT& cdt, CDT::Face_handle face, int obtuse_vertex, CDT::Point& steiner) override;
+
+private:
+    std::vector<std::unique_ptr<SteinerStrategy>> placements;
+    SolverOptions options;
+};
+
+#endif
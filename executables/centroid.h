@@ -1,12 +1,22 @@
+#ifndef CENTROID_H
+#define CENTROID_H
+
 #include <CGAL/Exact_predicates_exact_constructions_kernel.h>
 #include <CGAL/Delaunay_triangulation_2.h>
-#include <CGAL/draw_triangulation_2.h>
+#include <CGAL/Constrained_Delaunay_triangulation_2.h>
 #include <CGAL/convex_hull_2.h>
 #include <vector>
 #include <iostream>
+#include "strategy.h"
 
 typedef CGAL::Exact_predicates_exact_constructions_kernel K;
-typedef CGAL::Constrained_Delaunay_triangulation_2<K> DT; 
+typedef CDT DT;
 typedef DT::Point Point;
 
-int centroid_steiner_points(std::vector<Point> points, DT dt);
\ No newline at end of file
+// Places the Steiner point at the centroid of the obtuse triangle
+class CentroidStrategy : public SteinerStrategy {
+public:
+    bool candidate(const CDT& cdt, CDT::Face_handle face, int obtuse_vertex, CDT::Point& steiner) override;
+};
+
+#endif
@@ -1,70 +1,23 @@
 #include <CGAL/Exact_predicates_exact_constructions_kernel.h>
 #include <CGAL/Delaunay_triangulation_2.h>
-#include <CGAL/draw_triangulation_2.h>
+#include <CGAL/Constrained_Delaunay_triangulation_2.h>
 #include <CGAL/convex_hull_2.h>
 #include <vector>
 #include <iostream>
 #include <cmath>
-#include <CGAL/Polygon_2.h>
-#include <CGAL/Polygon_2_algorithms.h>
-#include "output.h"
+#include "circumcenter.h"
+#include "obtuse.h"
+#include "steiner.h"
 
 // Define CGAL types
 typedef CGAL::Exact_predicates_exact_constructions_kernel K;
-typedef CGAL::Constrained_Delaunay_triangulation_2<K> DT; 
+typedef CDT DT;
 typedef DT::Point Point;
 typedef DT::Edge Edge;
 typedef DT::Face_handle FaceHandle;
 typedef K::FT FT;
-typedef CGAL::Polygon_2<K> Polygon;
 
 
-// Συνάρτηση για έλεγχο αν ένα σημείο είναι εντός του κυρτού περιβλήματος
-bool is_within_convex_hull(const Point& p, const std::vector<Point>& convex_hull) {
-    Polygon hull_polygon(convex_hull.begin(), convex_hull.end());
-    return CGAL::bounded_side_2(hull_polygon.vertices_begin(), hull_polygon.vertices_end(), p, K()) 
-           != CGAL::ON_UNBOUNDED_SIDE;
-}
-
-
-// Function to calculate the angle between two points and a common vertex
-template <typename P>
-double angle_between(const P& p1, const P& p2, const P& p3) {
-    double a = std::sqrt(CGAL::to_double(CGAL::squared_distance(p2, p3)));
-    double b = std::sqrt(CGAL::to_double(CGAL::squared_distance(p1, p3)));
-    double c = std::sqrt(CGAL::to_double(CGAL::squared_distance(p1, p2)));
-
-    // Cosine rule to calculate the angle
-    double cos_angle = (b * b + c * c - a * a) / (2 * b * c);
-    return std::acos(cos_angle) * 180.0 / M_PI; // Return angle in degrees
-}
-
-// Function to check if a triangle is obtuse
-template <typename FaceHandle>
-int obtuse_vertex_index(const FaceHandle& face) {
-    double angle1 = angle_between(face->vertex(0)->point(), face->vertex(1)->point(), face->vertex(2)->point());
-    double angle2 = angle_between(face->vertex(1)->point(), face->vertex(2)->point(), face->vertex(0)->point());
-    double angle3 = angle_between(face->vertex(2)->point(), face->vertex(0)->point(), face->vertex(1)->point());
-    
-    if (angle1 > 90.0 + 0.01) return 0;
-    if (angle2 > 90.0 + 0.01) return 1;
-    if (angle3 > 90.0 + 0.01) return 2;
-    return -1;
-}
-
-template <typename FaceHandle>
-std::pair<int, double> obtuse_vertex_index_and_angle(const FaceHandle& face) {
-    double angle1 = angle_between(face->vertex(0)->point(), face->vertex(1)->point(), face->vertex(2)->point());
-    double angle2 = angle_between(face->vertex(1)->point(), face->vertex(2)->point(), face->vertex(0)->point());
-    double angle3 = angle_between(face->vertex(2)->point(), face->vertex(0)->point(), face->vertex(1)->point());
-    
-    if (angle1 > 90.0) return std::make_pair(0, angle1);
-    if (angle2 > 90.0) return std::make_pair(1, angle2);
-    if (angle3 > 90.0) return std::make_pair(2, angle3);
-    
-    return std::make_pair(-1, 0.0);  // No obtuse angle
-}
-
 // Function to calculate the circumcenter of a triangle
 Point circumcenter(const Point& p1, const Point& p2, const Point& p3) {
     // Using the CGAL function to calculate the circumcenter
@@ -73,112 +26,57 @@ Point circumcenter(const Point& p1, const Point& p2, const Point& p3) {
 
 
 
-// Function to print the edges of the triangulation
+// Function to place a Steiner point at the circumcenter of the obtuse triangle, or to split the constrained
+// edge that separates the triangle from its circumcenter
+// The segment from the triangle's centroid to the circumcenter is walked face by face: if it reaches the
+// face containing the circumcenter, that point is used; if it first crosses a constrained edge (the edge
+// is encroached), the midpoint of that edge is used instead, so faces along the boundary and the
+// additional constraints still get a point.
 template <typename DT>
-std::vector<std::pair<typename DT::Point, typename DT::Point>> print_edges(const DT& dt) {
-    // Define a vector to hold pairs of points representing edges
-    std::vector<std::pair<typename DT::Point, typename DT::Point>> edges;
-    for (auto edge = dt.finite_edges_begin(); edge != dt.finite_edges_end(); ++edge) {
-        auto v1 = edge->first->vertex((edge->second + 1) % 3)->point();
-        auto v2 = edge->first->vertex((edge->second + 2) % 3)->point();
-        // Add the edge to the vector
-        edges.emplace_back(v1, v2);
-    }
-
-    // Return the vector of edges
-    return edges;
-}
-
-template <typename DT>
-std::vector<Point> add_steiner_in_circumcenter(DT& dt, std::vector<Point> steiner_points,  const std::vector<Point>& convex_hull) {
-    bool added_steiner = false;
-
-    for (auto face = dt.finite_faces_begin(); face != dt.finite_faces_end(); ++face) {
-        int obtuse_vertex = obtuse_vertex_index(face);
-        if (obtuse_vertex != -1) {
-            Point p1 = face->vertex(0)->point();
-            Point p2 = face->vertex(1)->point();
-            Point p3 = face->vertex(2)->point();
-            Point circumcenter_point = circumcenter(p1, p2, p3);
-
-            // Έλεγχος αν το Steiner σημείο βρίσκεται εντός του κυρτού περιβλήματος
-            if (is_within_convex_hull(circumcenter_point, convex_hull)) {
-                steiner_points.push_back(circumcenter_point);
-                added_steiner = true;
+bool place_steiner_circumcenter(const DT& dt, typename DT::Face_handle face, Point& steiner) {
+    Point p1 = face->vertex(0)->point();
+    Point p2 = face->vertex(1)->point();
+    Point p3 = face->vertex(2)->point();
+    Point circumcenter_point = circumcenter(p1, p2, p3);
+    Point start = CGAL::centroid(p1, p2, p3);
+
+    typename DT::Face_handle current = face;
+    for (std::size_t steps = 0; steps <= dt.number_of_faces(); ++steps) {
+        // The segment leaves the face through the edge that has the circumcenter strictly on its outer side
+        // and that the segment's line crosses
+        int exit = -1;
+        for (int i = 0; i < 3 && exit == -1; ++i) {
+            const Point& a = current->vertex(DT::ccw(i))->point();
+            const Point& b = current->vertex(DT::cw(i))->point();
+            if (CGAL::orientation(a, b, circumcenter_point) == CGAL::RIGHT_TURN &&
+                CGAL::orientation(start, circumcenter_point, a) != CGAL::orientation(start, circumcenter_point, b)) {
+                exit = i;
             }
         }
-    }
-
-
-    // Insert Steiner points into the triangulation and re-triangulate
-    for (const Point& p : steiner_points) {
-        dt.insert(p);
-    }
-
-    if (added_steiner) {
-        return steiner_points;
-    } else {
-        return {};
-    }
-}
-
-int circumcenter_steiner_points(std::vector<Point> points, DT dt) {
-
-    std::vector<Point> convex_hull;
-    CGAL::convex_hull_2(points.begin(), points.end(), std::back_inserter(convex_hull));
-    std::vector<std::pair<typename DT::Point, typename DT::Point>> edges;
-
-    bool obtuse_exists = true;
-    int obtuse_count = 0;
-    int iterations = 0;
-    
-    std::vector<Point> steiner_points;
-
-    // Insert points into the triangulation
-    for (const Point& p : points) {
-        dt.insert(p);
-    }
-
-    CGAL::draw(dt);
-
-    obtuse_count = 0;  
-    for (auto face = dt.finite_faces_begin(); face != dt.finite_faces_end(); ++face) {
-        int obtuse_vertex = obtuse_vertex_index(face);
-        if (obtuse_vertex != -1) {
-            obtuse_count++;
+        if (exit == -1) {
+            // The circumcenter lies in this face (or on its boundary)
+            if (!in_domain(dt, current)) {
+                return false;
+            }
+            steiner = circumcenter_point;
+            return true;
         }
-    }
-
-    while (obtuse_exists && iterations <= 5) {
-        
-        steiner_points = add_steiner_in_circumcenter(dt, steiner_points, convex_hull);
-        
-        obtuse_exists = false;
-        obtuse_count = 0;
-
-        for (auto face = dt.finite_faces_begin(); face != dt.finite_faces_end(); ++face) {
-            auto obtuse = obtuse_vertex_index_and_angle(face);
-            auto obtuse_vertex = std::get<0>(obtuse);
-            auto obtuse_angle = std::get<1>(obtuse);
-            if (obtuse_vertex != -1) {
-                obtuse_exists = true;
-                obtuse_count++;
 
-                // Get coordinates of the obtuse vertex and print detailed information
-                Point obtuse_point = face->vertex(obtuse_vertex)->point();
-
-                // Print the coordinates of the other two vertices
-                Point p1 = face->vertex((obtuse_vertex + 1) % 3)->point();
-                Point p2 = face->vertex((obtuse_vertex + 2) % 3)->point();
-            }
+        if (current->is_constrained(exit)) {
+            steiner = CGAL::midpoint(current->vertex(DT::ccw(exit))->point(), current->vertex(DT::cw(exit))->point());
+            return true;
+        }
+        current = current->neighbor(exit);
+        if (dt.is_infinite(current)) {
+            return false;
         }
-        iterations++;
     }
+    return false;
+}
 
-    edges = print_edges(dt);
-
-    output(edges, steiner_points);
-    CGAL::draw(dt);
-
-    return 0;
+bool CircumcenterStrategy::candidate(const CDT& cdt, CDT::Face_handle face, int obtuse_vertex, CDT::Point& steiner) {
+    return place_steiner_circumcenter(cdt, face, steiner);
 }
+
+// Register the strategy under its command line name
+static bool registered = register_strategy("circumcenter", [] { return std::unique_ptr<Strategy>(new CircumcenterStrategy()); });
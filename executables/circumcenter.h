@@ -1,16 +1,23 @@
+#ifndef CIRCUMCENTER_H
+#define CIRCUMCENTER_H
+
 #include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
 #include <CGAL/Delaunay_triangulation_2.h>
-#include <CGAL/draw_triangulation_2.h>
+#include <CGAL/Constrained_Delaunay_triangulation_2.h>
 #include <CGAL/convex_hull_2.h>
 #include <vector>
 #include <iostream>
-#include <CGAL/Polygon_2.h>
-#include <CGAL/Polygon_2_algorithms.h>
+#include "strategy.h"
 
 typedef CGAL::Exact_predicates_exact_constructions_kernel K;
-typedef CGAL::Constrained_Delaunay_triangulation_2<K> DT; 
+typedef CDT DT;
 typedef DT::Point Point;
-typedef CGAL::Polygon_2<K> Polygon;
 
+// Places the Steiner point at the circumcenter of the obtuse triangle, or at the midpoint of the first
+// constrained edge between the triangle and its circumcenter (Ruppert-style encroachment handling)
+class CircumcenterStrategy : public SteinerStrategy {
+public:
+    bool candidate(const CDT& cdt, CDT::Face_handle face, int obtuse_vertex, CDT::Point& steiner) override;
+};
 
-int circumcenter_steiner_points(std::vector<Point> points, DT dt);
\ No newline at end of file
+#endif
@@ -0,0 +1,36 @@
+#include "context.h"
+#include "output.h"
+#include "visualize.h"
+#include "obtuse.h"
+#include <iostream>
+
+bool validate_solution(SolverContext& context) {
+    const CDT& cdt = context.cdt;
+    if (!cdt.tds().is_valid()) {
+        return false;
+    }
+    for (auto face = cdt.finite_faces_begin(); face != cdt.finite_faces_end(); ++face) {
+        if (in_domain(cdt, face) &&
+            CGAL::orientation(face->vertex(0)->point(), face->vertex(1)->point(), face->vertex(2)->point()) != CGAL::COUNTERCLOCKWISE) {
+            return false;
+        }
+    }
+
+    context.result.obtuse_faces = count_obtuse_faces(cdt);
+    if (context.result.obtuse_faces > 0) {
+        std::cerr << "Exact validation: " << context.result.obtuse_faces << " obtuse faces remain" << std::endl;
+    }
+    return true;
+}
+
+SolverResult write_solution(SolverContext& context) {
+    export_triangulation(context.cdt, static_cast<int>(context.input.points.size()), context.steiner_points, context.edges);
+    output(context.edges, context.steiner_points, context.input.instance_uid, context.options.output_path);
+    if (context.options.draw) {
+        draw_triangulation(context.cdt);
+    }
+
+    context.result.steiner_points = context.steiner_points.size();
+    context.result.obtuse_faces = count_obtuse_faces(context.cdt);
+    return context.result;
+}
@@ -0,0 +1,36 @@
+#ifndef CONTEXT_H
+#define CONTEXT_H
+
+#include <vector>
+#include <utility>
+#include "inputs.h"
+#include "options.h"
+#include "triangulation.h"
+
+// State of one solver run
+// The context owns the run's only triangulation; strategies refine it in place through a reference
+// and the exported solution is kept here instead of being copied between calls.
+struct SolverContext {
+    const InputData& input;
+    const SolverOptions& options;
+    CDT cdt;
+    std::vector<CDT::Point> steiner_points;  // coordinate table of the exported solution
+    std::vector<std::pair<int, int>> edges;  // edges of the exported solution, as vertex ids
+    SolverResult result;                     // counters of the run
+
+    SolverContext(const InputData& input, const SolverOptions& options) : input(input), options(options) {}
+    SolverContext(const SolverContext&) = delete;
+    SolverContext& operator=(const SolverContext&) = delete;
+};
+
+// Function to validate the refined triangulation exactly before it is written (fast mode)
+// Checks the combinatorics of the data structure and the orientation of the faces inside the domain,
+// but not the Delaunay property, which obtuse-reducing flips give up; then recounts the obtuse faces
+// with exact predicates into context.result
+// Returns false if the triangulation is broken
+bool validate_solution(SolverContext& context);
+
+// Function to export the refined triangulation, write the solution file and summarize the run
+SolverResult write_solution(SolverContext& context);
+
+#endif
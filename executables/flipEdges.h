@@ -1,13 +1,106 @@
+#ifndef FLIPEDGES_H
+#define FLIPEDGES_H
+
 #include <CGAL/Exact_predicates_exact_constructions_kernel.h>
 #include <CGAL/Delaunay_triangulation_2.h>
-#include <CGAL/draw_triangulation_2.h>
+#include <CGAL/Constrained_Delaunay_triangulation_2.h>
 #include <cmath> // For angle calculations
+#include <utility>
+#include <vector>
+#include "obtuse.h"
+#include "strategy.h"
 
 // Define CGAL types
 typedef CGAL::Exact_predicates_exact_constructions_kernel K;
-typedef CGAL::Constrained_Delaunay_triangulation_2<K> DT;  // Plain Delaunay triangulation
+typedef CDT DT;
 typedef DT::Point Point;
 typedef DT::Edge Edge;
 typedef DT::Face_handle FaceHandle;
 
-int flip_edges(std::vector<Point> points, DT dt);
\ No newline at end of file
+// Function to check if edge i of a face can be flipped: both faces are finite and inside the domain, the
+// edge is not constrained and the quadrilateral of the two faces is strictly convex
+// (CDT::is_flipable only accepts edges that are not locally Delaunay, so it cannot be used here)
+template <typename DT>
+bool is_flippable_edge(const DT& dt, typename DT::Face_handle face, int i) {
+    typename DT::Face_handle neighbor = face->neighbor(i);
+    if (face->is_constrained(i) || !in_domain(dt, face) || !in_domain(dt, neighbor)) {
+        return false;
+    }
+    const auto& c = face->vertex(i)->point();
+    const auto& d = dt.mirror_vertex(face, i)->point();
+    CGAL::Orientation side_a = CGAL::orientation(c, d, face->vertex(DT::cw(i))->point());
+    CGAL::Orientation side_b = CGAL::orientation(c, d, face->vertex(DT::ccw(i))->point());
+    return side_a != CGAL::COLLINEAR && side_b != CGAL::COLLINEAR && side_a != side_b;
+}
+
+// Function to get how many obtuse faces flipping edge i of a face removes (negative if it adds some)
+template <typename DT>
+int obtuse_faces_removed_by_flip(const DT& dt, typename DT::Face_handle face, int i) {
+    typename DT::Face_handle neighbor = face->neighbor(i);
+    const auto& a = face->vertex(DT::cw(i))->point();
+    const auto& b = face->vertex(DT::ccw(i))->point();
+    const auto& c = face->vertex(i)->point();
+    const auto& d = dt.mirror_vertex(face, i)->point();
+    int before = is_obtuse_triangle(face) + is_obtuse_triangle(neighbor);
+    int after = is_obtuse_triangle(c, a, d) + is_obtuse_triangle(c, d, b);
+    return before - after;
+}
+
+// Function to flip edges until no flip reduces the number of obtuse faces
+// Edges are queued as vertex pairs, which stay meaningful across flips; an edge is flipped only if the
+// flip strictly decreases the obtuse faces of its two faces, and then only the four edges around the
+// new diagonal are queued again. Every flip lowers the obtuse count, so the loop ends.
+// The new diagonals are appended to flipped if given. Returns the number of flips.
+template <typename DT>
+std::size_t flip_obtuse_edges(DT& dt, std::vector<std::pair<typename DT::Vertex_handle, typename DT::Vertex_handle>> queue,
+                              std::vector<std::pair<typename DT::Vertex_handle, typename DT::Vertex_handle>>* flipped = nullptr) {
+    std::size_t flips = 0;
+    while (!queue.empty()) {
+        auto edge = queue.back();
+        queue.pop_back();
+
+        typename DT::Face_handle face;
+        int i;
+        if (!dt.is_edge(edge.first, edge.second, face, i) || !is_flippable_edge(dt, face, i) ||
+            obtuse_faces_removed_by_flip(dt, face, i) <= 0) {
+            continue;
+        }
+        typename DT::Vertex_handle a = face->vertex(DT::cw(i));
+        typename DT::Vertex_handle b = face->vertex(DT::ccw(i));
+        typename DT::Vertex_handle c = face->vertex(i);
+        typename DT::Vertex_handle d = dt.mirror_vertex(face, i);
+        dt.flip(face, i);
+        flips++;
+        if (flipped != nullptr) {
+            flipped->emplace_back(c, d);
+        }
+
+        queue.emplace_back(a, c);
+        queue.emplace_back(c, b);
+        queue.emplace_back(b, d);
+        queue.emplace_back(d, a);
+    }
+    return flips;
+}
+
+// Function to queue the edges of the obtuse faces of the domain for flip_obtuse_edges
+template <typename DT>
+std::vector<std::pair<typename DT::Vertex_handle, typename DT::Vertex_handle>> obtuse_face_edges(const DT& dt) {
+    std::vector<std::pair<typename DT::Vertex_handle, typename DT::Vertex_handle>> queue;
+    for (auto face = dt.finite_faces_begin(); face != dt.finite_faces_end(); ++face) {
+        if (in_domain(dt, face) && is_obtuse_triangle(face)) {
+            for (int i = 0; i < 3; ++i) {
+                queue.emplace_back(face->vertex(DT::cw(i)), face->vertex(DT::ccw(i)));
+            }
+        }
+    }
+    return queue;
+}
+
+// Flips edges of obtuse faces while that removes obtuse faces, without adding Steiner points
+class FlipStrategy : public Strategy {
+public:
+    void run(SolverContext& context) override;
+};
+
+#endif
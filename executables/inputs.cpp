@@ -1,6 +1,8 @@
-#include <boost/property_tree/ptree.hpp>
-#include <boost/property_tree/json_parser.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <cctype>
 #include <iostream>
+#include <stdexcept>
+#include <string>
 #include <vector>
 #include <CGAL/Exact_predicates_exact_constructions_kernel.h>
 #include "inputs.h"
@@ -8,60 +10,278 @@
 typedef CGAL::Exact_predicates_exact_constructions_kernel K;
 typedef K::Point_2 Point;
 
-InputData inputs() {
-    // Creation of property tree
-    boost::property_tree::ptree pt;
+// Streaming reader for CG:SHOP instance files.
+// The file is memory-mapped and scanned once: coordinates are parsed straight into arrays sized
+// from num_points, without building a tree of strings first.
+class InstanceReader {
+public:
+    InstanceReader(const char* begin, const char* end) : pos(begin), end(end) {}
 
-    // Read from JSON file
-    try {
-        read_json("../input.json", pt);
-    } catch (const boost::property_tree::json_parser_error &e) {
-        std::cerr << "Error reading JSON: " << e.what() << std::endl;
-        return {};  // Return empty struct
+    void read(InputData& input) {
+        std::vector<K::FT> points_x, points_y;
+        std::size_t num_points = 0;
+
+        expect('{');
+        if (!consume('}')) {
+            do {
+                std::string key = read_string();
+                expect(':');
+                if (key == "instance_uid") {
+                    input.instance_uid = read_string();
+                } else if (key == "num_points") {
+                    num_points = static_cast<std::size_t>(read_int());
+                    points_x.reserve(num_points);
+                    points_y.reserve(num_points);
+                } else if (key == "points_x") {
+                    read_coordinates(points_x);
+                } else if (key == "points_y") {
+                    read_coordinates(points_y);
+                } else if (key == "region_boundary") {
+                    read_indices(input.region_boundary);
+                } else if (key == "additional_constraints") {
+                    expect('[');
+                    if (!consume(']')) {
+                        do {
+                            input.additional_constraints.emplace_back();
+                            read_indices(input.additional_constraints.back());
+                        } while (consume(','));
+                        expect(']');
+                    }
+                } else {
+                    skip_value();
+                }
+            } while (consume(','));
+            expect('}');
+        }
+
+        if (points_x.size() != points_y.size()) {
+            throw std::runtime_error("points_x and points_y have different lengths");
+        }
+        if (num_points != 0 && num_points != points_x.size()) {
+            std::cerr << "Warning: num_points is " << num_points << " but " << points_x.size() << " points were read" << std::endl;
+        }
+
+        // Create CGAL Point objects from the x and y coordinates
+        input.points.reserve(points_x.size());
+        for (std::size_t i = 0; i < points_x.size(); ++i) {
+            input.points.emplace_back(std::move(points_x[i]), std::move(points_y[i]));
+        }
+    }
+
+private:
+    const char* pos;
+    const char* end;
+
+    [[noreturn]] void fail(const std::string& message) const {
+        throw std::runtime_error(message);
     }
 
-    // Get data from property tree
-    std::string instance_uid = pt.get<std::string>("instance_uid");
-    int num_points = pt.get<int>("num_points");
+    void skip_whitespace() {
+        while (pos != end && (*pos == ' ' || *pos == '\n' || *pos == '\r' || *pos == '\t')) {
+            ++pos;
+        }
+    }
 
-    // Get points
-    std::vector<int> points_x;
-    for (const auto& point : pt.get_child("points_x")) {
-        points_x.push_back(point.second.get_value<int>());
+    // Consumes the character c if it is next
+    bool consume(char c) {
+        skip_whitespace();
+        if (pos != end && *pos == c) {
+            ++pos;
+            return true;
+        }
+        return false;
     }
 
-    std::vector<int> points_y;
-    for (const auto& point : pt.get_child("points_y")) {
-        points_y.push_back(point.second.get_value<int>());
+    void expect(char c) {
+        if (!consume(c)) {
+            fail(std::string("expected '") + c + "'");
+        }
     }
 
-    // Create CGAL Point objects from the x and y coordinates
-    std::vector<Point> points;
-    for (int i = 0; i < num_points; ++i) {
-        points.push_back(Point(points_x[i], points_y[i])); 
+    std::string read_string() {
+        expect('"');
+        std::string value;
+        while (pos != end && *pos != '"') {
+            if (*pos == '\\') {
+                ++pos;
+                if (pos == end) {
+                    break;
+                }
+            }
+            value.push_back(*pos++);
+        }
+        expect_raw('"');
+        return value;
     }
 
-    // Retrieve additional constraints
-    std::vector<std::vector<int>> additional_constraints;
-    for (const auto& row : pt.get_child("additional_constraints")) {
-        std::vector<int> row_values;
-        for (const auto& value : row.second) {
-            row_values.push_back(value.second.get_value<int>());
+    void expect_raw(char c) {
+        if (pos == end || *pos != c) {
+            fail(std::string("expected '") + c + "'");
         }
-        additional_constraints.push_back(row_values); 
+        ++pos;
     }
 
-    // Retrieve region_boundary
-    std::vector<int> region_boundary;
-    for (const auto& boundary_index : pt.get_child("region_boundary")) {
-        region_boundary.push_back(boundary_index.second.get_value<int>());
+    long long read_int() {
+        skip_whitespace();
+        bool negative = consume('-');
+        const char* first = pos;
+        long long value = 0;
+        while (pos != end && std::isdigit(static_cast<unsigned char>(*pos))) {
+            value = value * 10 + (*pos++ - '0');
+        }
+        if (first == pos) {
+            fail("expected an integer");
+        }
+        return negative ? -value : value;
     }
 
-    // Create inputData struct and populate it
+    // Parses a coordinate exactly: integers that fit in a double are converted directly, anything
+    // else (large integers, decimals, "p/q" strings) goes through the exact number type
+    K::FT read_coordinate() {
+        skip_whitespace();
+        if (pos != end && *pos == '"') {
+            std::string rational = read_string();
+            std::size_t slash = rational.find('/');
+            if (slash == std::string::npos) {
+                return K::FT(K::FT::ET(rational, 10));
+            }
+            return K::FT(K::FT::ET(rational.substr(0, slash), 10) / K::FT::ET(rational.substr(slash + 1), 10));
+        }
+
+        const char* first = pos;
+        bool negative = pos != end && *pos == '-';
+        if (negative) {
+            ++pos;
+        }
+        const char* digits = pos;
+        unsigned long long value = 0;
+        while (pos != end && std::isdigit(static_cast<unsigned char>(*pos))) {
+            value = value * 10 + static_cast<unsigned long long>(*pos++ - '0');
+        }
+        std::size_t num_digits = static_cast<std::size_t>(pos - digits);
+        if (num_digits == 0) {
+            fail("expected a number");
+        }
+        bool is_integer = pos == end || (*pos != '.' && *pos != 'e' && *pos != 'E');
+
+        // Exact in a double up to 2^53
+        if (is_integer && num_digits <= 15) {
+            double coordinate = static_cast<double>(value);
+            return K::FT(negative ? -coordinate : coordinate);
+        }
+        if (is_integer) {
+            return K::FT(K::FT::ET(std::string(first, pos), 10));
+        }
+        return read_decimal(first);
+    }
+
+    // Converts a decimal number such as -12.5e3 to an exact rational
+    K::FT read_decimal(const char* first) {
+        pos = first;
+        std::string mantissa;
+        if (*pos == '-') {
+            mantissa.push_back(*pos++);
+        }
+        long long exponent = 0;
+        while (pos != end && std::isdigit(static_cast<unsigned char>(*pos))) {
+            mantissa.push_back(*pos++);
+        }
+        if (pos != end && *pos == '.') {
+            ++pos;
+            while (pos != end && std::isdigit(static_cast<unsigned char>(*pos))) {
+                mantissa.push_back(*pos++);
+                exponent--;
+            }
+        }
+        if (pos != end && (*pos == 'e' || *pos == 'E')) {
+            ++pos;
+            bool negative_exponent = pos != end && *pos == '-';
+            if (pos != end && (*pos == '-' || *pos == '+')) {
+                ++pos;
+            }
+            long long e = 0;
+            while (pos != end && std::isdigit(static_cast<unsigned char>(*pos))) {
+                e = e * 10 + (*pos++ - '0');
+            }
+            exponent += negative_exponent ? -e : e;
+        }
+
+        std::string power = "1" + std::string(static_cast<std::size_t>(exponent < 0 ? -exponent : exponent), '0');
+        K::FT::ET value(mantissa, 10);  // base 10: a leading 0 must not select octal
+        if (exponent < 0) {
+            value /= K::FT::ET(power, 10);
+        } else {
+            value *= K::FT::ET(power, 10);
+        }
+        return K::FT(value);
+    }
+
+    void read_coordinates(std::vector<K::FT>& coordinates) {
+        expect('[');
+        if (consume(']')) {
+            return;
+        }
+        do {
+            coordinates.push_back(read_coordinate());
+        } while (consume(','));
+        expect(']');
+    }
+
+    void read_indices(std::vector<int>& indices) {
+        expect('[');
+        if (consume(']')) {
+            return;
+        }
+        do {
+            indices.push_back(static_cast<int>(read_int()));
+        } while (consume(','));
+        expect(']');
+    }
+
+    // Skips a value of a key the solver does not use
+    void skip_value() {
+        skip_whitespace();
+        if (pos == end) {
+            fail("unexpected end of file");
+        }
+        if (*pos == '"') {
+            read_string();
+        } else if (*pos == '[' || *pos == '{') {
+            char close = *pos == '[' ? ']' : '}';
+            ++pos;
+            if (consume(close)) {
+                return;
+            }
+            do {
+                if (close == '}') {
+                    read_string();
+                    expect(':');
+                }
+                skip_value();
+            } while (consume(','));
+            expect(close);
+        } else {
+            // Number, true, false or null
+            while (pos != end && *pos != ',' && *pos != '}' && *pos != ']' &&
+                   *pos != ' ' && *pos != '\n' && *pos != '\r' && *pos != '\t') {
+                ++pos;
+            }
+        }
+    }
+};
+
+InputData inputs(const std::string& input_path) {
     InputData input_data;
-    input_data.points = points;
-    input_data.region_boundary = region_boundary;
-    input_data.additional_constraints = additional_constraints;
 
-    return input_data; 
+    // Read from JSON file through a memory mapping
+    try {
+        boost::iostreams::mapped_file_source file(input_path);
+        InstanceReader reader(file.data(), file.data() + file.size());
+        reader.read(input_data);
+    } catch (const std::exception& e) {
+        std::cerr << "Error reading JSON " << input_path << ": " << e.what() << std::endl;
+        return {};  // Return empty struct
+    }
+
+    return input_data;
 }
@@ -0,0 +1,60 @@
+#include <chrono>
+#include <iostream>
+#include <random>
+#include "local_search.h"
+#include "moves.h"
+
+double optimizer_budget(const SolverOptions& options) {
+    return options.time_limit > 0.0 ? options.time_limit : options.default_budget;
+}
+
+bool run_initial_strategy(SolverContext& context, const std::string& optimizer) {
+    const std::string& name = context.options.initial_strategy;
+    if (name == optimizer) {
+        std::cerr << "The initial strategy of " << optimizer << " cannot be " << name << std::endl;
+        return false;
+    }
+    std::unique_ptr<Strategy> initial = make_strategy(name);
+    if (!initial) {
+        std::cerr << "Unknown initial strategy: " << name << std::endl;
+        return false;
+    }
+    initial->run(context);
+    return true;
+}
+
+void LocalSearchStrategy::run(SolverContext& context) {
+    if (!run_initial_strategy(context, "local-search")) {
+        return;
+    }
+
+    std::vector<std::unique_ptr<SteinerStrategy>> owned = make_placements(context);
+    std::vector<SteinerStrategy*> placements;
+    for (const auto& placement : owned) {
+        placements.push_back(placement.get());
+    }
+    LocalMoves moves(context, placements);
+    std::mt19937 rng(context.options.seed);
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::duration<double>(optimizer_budget(context.options));
+    for (std::size_t step = 0; moves.obtuse_faces() > 0 || moves.steiner_points() > 0; ++step) {
+        // Checking the clock every few moves keeps it out of the profile
+        if (step % 64 == 0 && (std::chrono::steady_clock::now() >= deadline ||
+                               (context.options.should_stop && context.options.should_stop(moves.steiner_points())))) {
+            break;
+        }
+        MoveDelta delta = moves.random_move(rng);
+        if (!delta.applied) {
+            continue;
+        }
+        context.result.moves_tried++;
+        if (move_cost(delta, context.options.obtuse_weight) <= 0) {
+            context.result.moves_accepted++;
+        } else {
+            moves.undo();
+        }
+    }
+}
+
+// Register the strategy under its command line name
+static bool registered = register_strategy("local-search", [] { return std::unique_ptr<Strategy>(new LocalSearchStrategy()); });
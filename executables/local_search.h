@@ -0,0 +1,27 @@
+#ifndef LOCAL_SEARCH_H
+#define LOCAL_SEARCH_H
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <string>
+#include "strategy.h"
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel K;
+typedef CDT DT;
+typedef DT::Point Point;
+
+// Improves the solution of a greedy strategy (options.initial_strategy) with local moves until the
+// time budget runs out: a move is kept when it does not increase the cost, an obtuse face costing
+// options.obtuse_weight Steiner points, and undone otherwise
+class LocalSearchStrategy : public Strategy {
+public:
+    void run(SolverContext& context) override;
+};
+
+// Function to get the wall-clock budget of an optimizer in seconds
+double optimizer_budget(const SolverOptions& options);
+
+// Function to run the initial strategy of an optimizer on the context
+// Returns false if it is unknown or is an optimizer itself
+bool run_initial_strategy(SolverContext& context, const std::string& optimizer);
+
+#endif
@@ -0,0 +1,446 @@
+#include <algorithm>
+#include "flipEdges.h"
+#include "moves.h"
+#include "obtuse.h"
+#include "steiner.h"
+
+LocalMoves::LocalMoves(SolverContext& context, const std::vector<SteinerStrategy*>& placements)
+    : context(context), cdt(context.cdt), placements(placements) {
+    int num_input_points = static_cast<int>(context.input.points.size());
+    for (auto v = cdt.finite_vertices_begin(); v != cdt.finite_vertices_end(); ++v) {
+        if (v->info().id < 0 || v->info().id >= num_input_points) {
+            steiner_index[v] = steiner_vertices.size();
+            steiner_vertices.push_back(v);
+        }
+    }
+    recount();
+}
+
+void LocalMoves::begin_move() {
+    last_move.clear();
+    obtuse_before = obtuse_count;
+    steiner_before = steiner_points();
+}
+
+MoveDelta LocalMoves::end_move() {
+    MoveDelta delta;
+    delta.applied = !last_move.empty();
+    delta.obtuse_faces = obtuse_count - obtuse_before;
+    delta.steiner_points = steiner_points() - steiner_before;
+    return delta;
+}
+
+// Function to recount the obtuse faces of the whole triangulation and refill the pool
+void LocalMoves::recount() {
+    obtuse_pool.clear();
+    for (auto face = cdt.finite_faces_begin(); face != cdt.finite_faces_end(); ++face) {
+        if (in_domain(cdt, face) && is_obtuse_triangle(face)) {
+            obtuse_pool.push_back(face);
+        }
+    }
+    obtuse_count = static_cast<int>(obtuse_pool.size());
+}
+
+// Function to count the obtuse faces inside the domain incident to a set of vertices, each face once
+// With collect, the obtuse faces found are added to the pool
+int LocalMoves::count_obtuse_around(const std::vector<VertexHandle>& vertices, bool collect) {
+    std::vector<FaceHandle> faces;
+    for (VertexHandle v : vertices) {
+        if (cdt.is_infinite(v)) {
+            continue;
+        }
+        auto circulator = cdt.incident_faces(v), done = circulator;
+        do {
+            if (!cdt.is_infinite(circulator)) {
+                faces.push_back(circulator);
+            }
+        } while (++circulator != done);
+    }
+    std::sort(faces.begin(), faces.end());
+    faces.erase(std::unique(faces.begin(), faces.end()), faces.end());
+
+    int obtuse = 0;
+    for (FaceHandle face : faces) {
+        if (in_domain(cdt, face) && is_obtuse_triangle(face)) {
+            obtuse++;
+            if (collect) {
+                obtuse_pool.push_back(face);
+            }
+        }
+    }
+    return obtuse;
+}
+
+// Function to pick a random obtuse face from the pool, dropping the entries that are no longer obtuse faces
+bool LocalMoves::pick_obtuse_face(std::mt19937& rng, FaceHandle& face, int& obtuse_vertex) {
+    while (true) {
+        if (obtuse_pool.empty()) {
+            if (obtuse_count == 0) {
+                return false;
+            }
+            recount();
+            if (obtuse_pool.empty()) {
+                return false;
+            }
+        }
+        std::size_t index = std::uniform_int_distribution<std::size_t>(0, obtuse_pool.size() - 1)(rng);
+        face = obtuse_pool[index];
+        // A destroyed face's slot may be free or reused: only faces stored in the triangulation are looked at
+        if (cdt.tds().faces().owns(face) && in_domain(cdt, face)) {
+            obtuse_vertex = obtuse_vertex_index(face);
+            if (obtuse_vertex != -1) {
+                return true;
+            }
+        }
+        obtuse_pool[index] = obtuse_pool.back();
+        obtuse_pool.pop_back();
+    }
+}
+
+// Function to check if a Steiner vertex can be removed: either it is free (no constraint, not on the
+// convex hull) or it only splits a constrained edge, which is given back to its two neighbors
+bool LocalMoves::removable(VertexHandle v) const {
+    if (!cdt.are_there_incident_constraints(v)) {
+        auto circulator = cdt.incident_vertices(v), done = circulator;
+        do {
+            if (cdt.is_infinite(circulator)) {
+                return false;
+            }
+        } while (++circulator != done);
+        return true;
+    }
+
+    std::vector<VertexHandle> constrained;
+    auto edge = cdt.incident_edges(v), done = edge;
+    do {
+        if (cdt.is_constrained(*edge)) {
+            VertexHandle other = edge->first->vertex(CDT::ccw(edge->second));
+            constrained.push_back(other == v ? edge->first->vertex(CDT::cw(edge->second)) : other);
+        }
+    } while (++edge != done);
+    return constrained.size() == 2 &&
+           CGAL::collinear_are_strictly_ordered_along_line(constrained[0]->point(), v->point(), constrained[1]->point());
+}
+
+// Function to insert a Steiner point, measuring the change of obtuse faces on its conflict zone
+// The zone is searched from the located face through non-constrained edges; every face the insertion
+// destroys has its vertices among the zone's vertices and every face it creates is incident to the new
+// vertex. If CGAL re-triangulated beyond the zone (the new vertex has a neighbor outside of it), the
+// whole triangulation is recounted instead.
+bool LocalMoves::insert_point(const Point& p, FaceHandle hint, bool record) {
+    DT::Locate_type lt;
+    int li;
+    FaceHandle located = cdt.locate(p, lt, li, hint);
+    if (!in_domain(cdt, p, located)) {
+        return false;  // outside the region boundary, or an existing vertex
+    }
+
+    std::vector<FaceHandle> zone, stack;
+    stack.push_back(located);
+    if (lt == DT::EDGE && !cdt.is_infinite(located->neighbor(li))) {
+        stack.push_back(located->neighbor(li));
+    }
+    while (!stack.empty()) {
+        FaceHandle face = stack.back();
+        stack.pop_back();
+        if (std::find(zone.begin(), zone.end(), face) != zone.end()) {
+            continue;
+        }
+        zone.push_back(face);
+        for (int i = 0; i < 3; ++i) {
+            FaceHandle neighbor = face->neighbor(i);
+            if (!face->is_constrained(i) && !cdt.is_infinite(neighbor) &&
+                cdt.side_of_oriented_circle(neighbor, p) == CGAL::ON_POSITIVE_SIDE) {
+                stack.push_back(neighbor);
+            }
+        }
+    }
+    std::vector<VertexHandle> vertices;
+    for (FaceHandle face : zone) {
+        for (int i = 0; i < 3; ++i) {
+            vertices.push_back(face->vertex(i));
+        }
+    }
+    std::sort(vertices.begin(), vertices.end());
+    vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
+
+    int before = count_obtuse_around(vertices, false);
+    VertexHandle v = cdt.insert(p, located);
+    unmark_incident_faces(cdt, v);
+
+    bool local = true;
+    auto circulator = cdt.incident_vertices(v), done = circulator;
+    do {
+        if (!cdt.is_infinite(circulator) && !std::binary_search(vertices.begin(), vertices.end(), VertexHandle(circulator))) {
+            local = false;
+        }
+    } while (++circulator != done);
+    if (local) {
+        vertices.push_back(v);
+        obtuse_count += count_obtuse_around(vertices, true) - before;
+    } else {
+        recount();
+    }
+
+    steiner_index[v] = steiner_vertices.size();
+    steiner_vertices.push_back(v);
+    if (record) {
+        last_move.push_back({Operation::INSERTED, p, VertexHandle(), VertexHandle()});
+    }
+    return true;
+}
+
+// Function to remove a Steiner vertex, measuring the change of obtuse faces
+// The obtuse faces of the star are counted before anything changes. A free vertex leaves a hole that is
+// re-triangulated with the star's boundary vertices only, so the star's former neighbors are counted
+// again. A vertex that splits a constrained edge gives the constraint back to its two constrained
+// neighbors: releasing and restoring the constraint flips edges beyond the star and can carry faces
+// across the region boundary, so the domain is marked again and every face is recounted.
+void LocalMoves::remove_steiner_vertex(std::size_t index, bool record) {
+    VertexHandle v = steiner_vertices[index];
+    Point p = v->point();
+
+    std::vector<VertexHandle> vertices;
+    auto circulator = cdt.incident_vertices(v), done = circulator;
+    do {
+        vertices.push_back(circulator);
+    } while (++circulator != done);
+    VertexHandle neighbor = vertices.front();
+
+    if (cdt.are_there_incident_constraints(v)) {
+        std::vector<VertexHandle> constrained;
+        auto edge = cdt.incident_edges(v), edges_done = edge;
+        do {
+            if (cdt.is_constrained(*edge)) {
+                constrained.push_back(edge->first->vertex(CDT::ccw(edge->second)) == v
+                                          ? edge->first->vertex(CDT::cw(edge->second))
+                                          : edge->first->vertex(CDT::ccw(edge->second)));
+            }
+        } while (++edge != edges_done);
+        cdt.remove_incident_constraints(v);
+        cdt.remove(v);
+        if (constrained.size() == 2) {
+            cdt.insert_constraint(constrained[0], constrained[1]);
+        }
+        mark_domain(cdt);
+        recount();
+    } else {
+        vertices.push_back(v);
+        int before = count_obtuse_around(vertices, false);
+        vertices.pop_back();
+        cdt.remove(v);
+        obtuse_count += count_obtuse_around(vertices, true) - before;
+    }
+
+    steiner_index.erase(v);
+    steiner_vertices[index] = steiner_vertices.back();
+    steiner_vertices.pop_back();
+    if (index < steiner_vertices.size()) {
+        steiner_index[steiner_vertices[index]] = index;
+    }
+    if (record) {
+        last_move.push_back({Operation::REMOVED, p, neighbor, VertexHandle()});
+    }
+}
+
+// Function to flip an edge, measuring the change of obtuse faces on the two faces of its quadrilateral
+bool LocalMoves::flip_edge(FaceHandle face, int i, bool record) {
+    if (!is_flippable_edge(cdt, face, i)) {
+        return false;
+    }
+    VertexHandle a = face->vertex(i);
+    VertexHandle c = cdt.mirror_vertex(face, i);
+    std::vector<VertexHandle> vertices = {face->vertex(0), face->vertex(1), face->vertex(2), c};
+
+    int before = count_obtuse_around(vertices, false);
+    cdt.flip(face, i);
+    obtuse_count += count_obtuse_around(vertices, true) - before;
+
+    if (record) {
+        last_move.push_back({Operation::FLIPPED, Point(), a, c});
+    }
+    return true;
+}
+
+MoveDelta LocalMoves::insert_into_obtuse_face(std::mt19937& rng) {
+    begin_move();
+    FaceHandle face;
+    int obtuse_vertex;
+    if (placements.empty() || steiner_points() >= static_cast<int>(context.options.max_steiner) ||
+        !pick_obtuse_face(rng, face, obtuse_vertex)) {
+        return end_move();
+    }
+
+    SteinerStrategy* placement = placements[std::uniform_int_distribution<std::size_t>(0, placements.size() - 1)(rng)];
+    Point steiner;
+    if (!placement->candidate(cdt, face, obtuse_vertex, steiner)) {
+        return end_move();
+    }
+    snap_steiner_point(cdt, face, obtuse_vertex, context.options, steiner);
+    if (placement->accept(cdt, face, obtuse_vertex, steiner)) {
+        insert_point(steiner, face, true);
+    }
+    return end_move();
+}
+
+MoveDelta LocalMoves::remove_steiner_point(std::mt19937& rng) {
+    begin_move();
+    for (int attempt = 0; attempt < 8 && !steiner_vertices.empty(); ++attempt) {
+        std::size_t index = std::uniform_int_distribution<std::size_t>(0, steiner_vertices.size() - 1)(rng);
+        if (removable(steiner_vertices[index])) {
+            remove_steiner_vertex(index, true);
+            break;
+        }
+    }
+    return end_move();
+}
+
+MoveDelta LocalMoves::remove_steiner_point(VertexHandle v) {
+    begin_move();
+    auto found = steiner_index.find(v);
+    if (found != steiner_index.end() && removable(v)) {
+        remove_steiner_vertex(found->second, true);
+    }
+    return end_move();
+}
+
+MoveDelta LocalMoves::move_steiner_point(std::mt19937& rng) {
+    begin_move();
+    if (steiner_vertices.empty()) {
+        return end_move();
+    }
+    std::size_t index = std::uniform_int_distribution<std::size_t>(0, steiner_vertices.size() - 1)(rng);
+    VertexHandle v = steiner_vertices[index];
+    if (cdt.are_there_incident_constraints(v) || !removable(v)) {
+        return end_move();
+    }
+
+    // Target: the centroid of the neighbors, or halfway to it, as long as it stays inside the star of v
+    double sum_x = 0.0, sum_y = 0.0;
+    int degree = 0;
+    auto circulator = cdt.incident_vertices(v), done = circulator;
+    do {
+        sum_x += CGAL::to_double(circulator->point().x());
+        sum_y += CGAL::to_double(circulator->point().y());
+        degree++;
+    } while (++circulator != done);
+    double vx = CGAL::to_double(v->point().x()), vy = CGAL::to_double(v->point().y());
+
+    for (double t : {1.0, 0.5}) {
+        Point target(vx + t * (sum_x / degree - vx), vy + t * (sum_y / degree - vy));
+        DT::Locate_type lt;
+        int li;
+        FaceHandle located = cdt.locate(target, lt, li, v->face());
+        if ((lt == DT::FACE || lt == DT::EDGE) && located->has_vertex(v)) {
+            VertexHandle neighbor = v->face()->vertex(CDT::ccw(v->face()->index(v)));
+            remove_steiner_vertex(index, true);
+            insert_point(target, neighbor->face(), true);
+            break;
+        }
+    }
+    return end_move();
+}
+
+MoveDelta LocalMoves::flip_obtuse_edge(std::mt19937& rng) {
+    begin_move();
+    FaceHandle face;
+    int obtuse_vertex;
+    if (pick_obtuse_face(rng, face, obtuse_vertex)) {
+        // The edge opposite the obtuse angle is the longest one
+        flip_edge(face, obtuse_vertex, true);
+    }
+    return end_move();
+}
+
+MoveDelta LocalMoves::random_move(std::mt19937& rng) {
+    double r = std::uniform_real_distribution<double>(0.0, 1.0)(rng);
+    if (obtuse_count > 0) {
+        if (r < 0.4) {
+            return insert_into_obtuse_face(rng);
+        }
+        if (r < 0.6) {
+            return flip_obtuse_edge(rng);
+        }
+        if (r < 0.8) {
+            return move_steiner_point(rng);
+        }
+        return remove_steiner_point(rng);
+    }
+    // Without obtuse faces only fewer Steiner points can improve the solution
+    return r < 0.5 ? move_steiner_point(rng) : remove_steiner_point(rng);
+}
+
+// Function to flip the edges around a set of vertices while that removes obtuse faces, measuring each flip
+void LocalMoves::repair(const std::vector<VertexHandle>& vertices) {
+    std::vector<std::pair<VertexHandle, VertexHandle>> queue;
+    for (VertexHandle v : vertices) {
+        auto circulator = cdt.incident_faces(v), done = circulator;
+        do {
+            if (!cdt.is_infinite(circulator)) {
+                for (int i = 0; i < 3; ++i) {
+                    queue.emplace_back(circulator->vertex(CDT::cw(i)), circulator->vertex(CDT::ccw(i)));
+                }
+            }
+        } while (++circulator != done);
+    }
+
+    while (!queue.empty()) {
+        auto edge = queue.back();
+        queue.pop_back();
+        FaceHandle face;
+        int i;
+        if (!cdt.is_edge(edge.first, edge.second, face, i) || !is_flippable_edge(cdt, face, i) ||
+            obtuse_faces_removed_by_flip(cdt, face, i) <= 0) {
+            continue;
+        }
+        VertexHandle a = face->vertex(CDT::cw(i));
+        VertexHandle b = face->vertex(CDT::ccw(i));
+        VertexHandle c = face->vertex(i);
+        VertexHandle d = cdt.mirror_vertex(face, i);
+        flip_edge(face, i, false);
+        queue.emplace_back(a, c);
+        queue.emplace_back(c, b);
+        queue.emplace_back(b, d);
+        queue.emplace_back(d, a);
+    }
+}
+
+void LocalMoves::undo() {
+    // Vertices whose stars the reverted operations re-created
+    std::vector<VertexHandle> touched;
+    for (auto op = last_move.rbegin(); op != last_move.rend(); ++op) {
+        switch (op->kind) {
+        case Operation::INSERTED: {
+            // The vertex inserted last is at the back of the Steiner vertices
+            auto neighbor = cdt.incident_vertices(steiner_vertices.back()), done = neighbor;
+            do {
+                if (!cdt.is_infinite(neighbor)) {
+                    touched.push_back(neighbor);
+                }
+            } while (++neighbor != done);
+            remove_steiner_vertex(steiner_vertices.size() - 1, false);
+            break;
+        }
+        case Operation::REMOVED:
+            if (insert_point(op->point, op->a->face(), false)) {
+                touched.push_back(steiner_vertices.back());
+            }
+            break;
+        case Operation::FLIPPED: {
+            FaceHandle face;
+            int i;
+            if (cdt.is_edge(op->a, op->b, face, i)) {
+                flip_edge(face, i, false);
+            }
+            break;
+        }
+        }
+    }
+    last_move.clear();
+
+    // The CDT rebuilds a Delaunay star on insertion and removal, which drops the edges earlier flips
+    // placed there: flip them back in while that removes obtuse faces
+    if (obtuse_count > obtuse_before) {
+        repair(touched);
+    }
+}
@@ -0,0 +1,97 @@
+#ifndef MOVES_H
+#define MOVES_H
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <map>
+#include <random>
+#include <vector>
+#include "strategy.h"
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel K;
+typedef CDT DT;
+typedef DT::Point Point;
+typedef DT::Vertex_handle VertexHandle;
+typedef DT::Face_handle FaceHandle;
+
+// Change of the objective made by a move
+struct MoveDelta {
+    bool applied = false;    // false if the move changed nothing
+    int obtuse_faces = 0;    // change of the number of obtuse faces
+    int steiner_points = 0;  // change of the number of Steiner points
+};
+
+// Function to weigh a change of the objective, obtuse faces counting obtuse_weight Steiner points each
+inline int move_cost(const MoveDelta& delta, int obtuse_weight) {
+    return delta.obtuse_faces * obtuse_weight + delta.steiner_points;
+}
+
+// Local moves on a refined triangulation, shared by the optimizers
+// A move inserts a Steiner point into an obtuse face (with one of the placements), removes a Steiner
+// point, moves one towards the centroid of its neighbors, or flips the longest edge of an obtuse face.
+// A move is applied right away and measured on the faces it touches only: the obtuse faces incident
+// to a vertex set that holds every destroyed and created face are counted before and after it. Moves
+// that change faces beyond such a set (removing a vertex on a constraint) recount the triangulation.
+// The last move can be undone.
+class LocalMoves {
+public:
+    LocalMoves(SolverContext& context, const std::vector<SteinerStrategy*>& placements);
+
+    int obtuse_faces() const { return obtuse_count; }
+    int steiner_points() const { return static_cast<int>(steiner_vertices.size()); }
+
+    // Applies a random move, favoring insertions and flips while obtuse faces are left
+    MoveDelta random_move(std::mt19937& rng);
+
+    MoveDelta insert_into_obtuse_face(std::mt19937& rng);
+    MoveDelta remove_steiner_point(std::mt19937& rng);
+    MoveDelta move_steiner_point(std::mt19937& rng);
+    MoveDelta flip_obtuse_edge(std::mt19937& rng);
+
+    // Removes a given Steiner vertex, if it is removable (see removable())
+    MoveDelta remove_steiner_point(VertexHandle v);
+
+    // Steiner vertices, in no particular order
+    const std::vector<VertexHandle>& steiner() const { return steiner_vertices; }
+
+    // Reverts the last applied move: the Steiner points and flipped edges are restored
+    // A re-inserted or removed point gets a Delaunay star, which may lack edges that earlier flips had
+    // placed; if the obtuse faces are then above their count before the move, the edges around the
+    // re-created stars are flipped while that removes obtuse faces. The counters follow the faces
+    // actually re-created, so obtuse_faces() tells whether the move was fully reverted.
+    void undo();
+
+private:
+    // A change of the triangulation, recorded so that it can be reverted
+    struct Operation {
+        enum Kind { INSERTED, REMOVED, FLIPPED } kind;
+        Point point;       // REMOVED: the point of the removed vertex
+        VertexHandle a;    // REMOVED: a former neighbor, to locate from; FLIPPED: an endpoint of the new edge
+        VertexHandle b;    // FLIPPED: the other endpoint of the new edge
+    };
+
+    SolverContext& context;
+    CDT& cdt;
+    std::vector<SteinerStrategy*> placements;
+    std::vector<VertexHandle> steiner_vertices;  // every Steiner vertex, in no particular order
+    std::map<VertexHandle, std::size_t> steiner_index;  // position of each Steiner vertex in steiner_vertices
+    std::vector<FaceHandle> obtuse_pool;         // obtuse faces seen so far, possibly stale
+    std::vector<Operation> last_move;
+    int obtuse_count = 0;
+    int steiner_before = 0;
+    int obtuse_before = 0;
+
+    void begin_move();
+    MoveDelta end_move();
+
+    bool pick_obtuse_face(std::mt19937& rng, FaceHandle& face, int& obtuse_vertex);
+    bool removable(VertexHandle v) const;
+    int count_obtuse_around(const std::vector<VertexHandle>& vertices, bool collect);
+    void recount();
+
+    bool insert_point(const Point& p, FaceHandle hint, bool record);
+    void remove_steiner_vertex(std::size_t index, bool record);
+    bool flip_edge(FaceHandle face, int i, bool record);
+    void repair(const std::vector<VertexHandle>& vertices);
+};
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef OBTUSE_H
+#define OBTUSE_H
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <cmath>
+#include "triangulation.h"
+
+// Shared obtuse-triangle predicate used by every Steiner strategy.
+// The angle at q in (p, q, r) is obtuse exactly when the dot product (p - q) * (r - q) is negative.
+// CGAL::angle evaluates that sign as a filtered predicate: with the exact kernel it is computed
+// with interval arithmetic first and only falls back to exact arithmetic when the sign is ambiguous,
+// so no square roots, no acos and no tolerance are involved.
+
+// Function to check if the angle of a face at vertex i is obtuse
+template <typename FaceHandle>
+bool is_obtuse_at(const FaceHandle& face, int i) {
+    return CGAL::angle(face->vertex((i + 1) % 3)->point(),
+                       face->vertex(i)->point(),
+                       face->vertex((i + 2) % 3)->point()) == CGAL::OBTUSE;
+}
+
+// Function to check if a triangle is obtuse
+// Returns the index of the obtuse angle's vertex or -1 if no obtuse angle is found
+template <typename FaceHandle>
+int obtuse_vertex_index(const FaceHandle& face) {
+    for (int i = 0; i < 3; ++i) {
+        if (is_obtuse_at(face, i)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Function to check if a triangle is obtuse (has an angle > 90 degrees)
+template <typename FaceHandle>
+bool is_obtuse_triangle(const FaceHandle& face) {
+    return obtuse_vertex_index(face) != -1;
+}
+
+// Function to check if the triangle (p, q, r) is obtuse, for triangles that are not faces yet
+template <typename Point>
+bool is_obtuse_triangle(const Point& p, const Point& q, const Point& r) {
+    return CGAL::angle(q, p, r) == CGAL::OBTUSE ||
+           CGAL::angle(p, q, r) == CGAL::OBTUSE ||
+           CGAL::angle(p, r, q) == CGAL::OBTUSE;
+}
+
+// Function to count the obtuse faces inside the region boundary (see in_domain)
+template <typename DT>
+int count_obtuse_faces(const DT& dt) {
+    int obtuse_count = 0;
+    for (auto face = dt.finite_faces_begin(); face != dt.finite_faces_end(); ++face) {
+        if (in_domain(dt, face) && obtuse_vertex_index(face) != -1) {
+            obtuse_count++;
+        }
+    }
+    return obtuse_count;
+}
+
+// Function to approximate the cosine of the angle of a face at vertex i
+// Only used to order work (most obtuse angle first), never to decide obtuseness
+template <typename FaceHandle>
+double approximate_angle_cosine(const FaceHandle& face, int i) {
+    const auto& q = face->vertex(i)->point();
+    const auto& a = face->vertex((i + 1) % 3)->point();
+    const auto& b = face->vertex((i + 2) % 3)->point();
+    double ux = CGAL::to_double(a.x()) - CGAL::to_double(q.x());
+    double uy = CGAL::to_double(a.y()) - CGAL::to_double(q.y());
+    double vx = CGAL::to_double(b.x()) - CGAL::to_double(q.x());
+    double vy = CGAL::to_double(b.y()) - CGAL::to_double(q.y());
+    double norms = std::sqrt((ux * ux + uy * uy) * (vx * vx + vy * vy));
+    return norms > 0.0 ? (ux * vx + uy * vy) / norms : 0.0;
+}
+
+#endif
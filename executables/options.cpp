@@ -0,0 +1,49 @@
+#include <boost/program_options.hpp>
+#include <iostream>
+#include "options.h"
+
+namespace po = boost::program_options;
+
+bool parse_options(int argc, char* argv[], SolverOptions& options) {
+    po::options_description description("Options");
+    description.add_options()
+        ("help,h", "show this message")
+        ("input,i", po::value<std::string>(&options.input_path)->default_value(options.input_path), "instance JSON file")
+        ("output,o", po::value<std::string>(&options.output_path)->default_value(options.output_path), "solution JSON file")
+        ("strategy,s", po::value<std::string>(&options.strategy),
+            "center, projection, circumcenter, convex-centroid, centroid, flip, best, local-search, annealing, ant-colony or portfolio (asked interactively if omitted)")
+        ("max-steiner", po::value<std::size_t>(&options.max_steiner)->default_value(options.max_steiner), "maximum number of Steiner points")
+        ("time-limit", po::value<double>(&options.time_limit)->default_value(options.time_limit), "time limit in seconds, 0 for none (optimizers then run for 10 seconds)")
+        ("seed", po::value<unsigned int>(&options.seed)->default_value(options.seed), "random seed")
+        ("draw", po::bool_switch(&options.draw), "show the triangulation before and after solving")
+        ("max-denominator", po::value<unsigned long>(&options.max_denominator)->default_value(options.max_denominator),
+            "snap Steiner coordinates to rationals with denominators up to this, 0 to keep them exact")
+        ("flip-first", po::bool_switch(&options.flip_first), "flip edges of obtuse faces to a fixpoint before inserting Steiner points")
+        ("interleave-flips", po::bool_switch(&options.interleave_flips), "flip first, then follow each Steiner point with flips in its star")
+        ("prune", po::bool_switch(&options.prune), "remove the Steiner points the finished solution does not need")
+        ("fast", po::bool_switch(&options.fast), "snap Steiner points to a dyadic grid of doubles, then validate the result exactly")
+        ("grid-bits", po::value<int>(&options.grid_bits)->default_value(options.grid_bits), "fast mode grid resolution relative to the face size")
+        ("initial", po::value<std::string>(&options.initial_strategy)->default_value(options.initial_strategy), "strategy that builds the starting solution of an optimizer")
+        ("obtuse-weight", po::value<int>(&options.obtuse_weight)->default_value(options.obtuse_weight), "optimizer cost of one obtuse face, in Steiner points")
+        ("initial-temperature", po::value<double>(&options.initial_temperature)->default_value(options.initial_temperature), "annealing start temperature")
+        ("final-temperature", po::value<double>(&options.final_temperature)->default_value(options.final_temperature), "annealing end temperature")
+        ("batch", po::value<std::string>(&options.batch_path), "solve every instance of a directory or manifest file (one path per line)")
+        ("output-dir", po::value<std::string>(&options.output_dir)->default_value(options.output_dir), "directory for batch solutions and summary.csv")
+        ("jobs,j", po::value<unsigned int>(&options.jobs)->default_value(options.jobs), "worker threads of batch mode and ant-colony, 0 for one per hardware thread");
+
+    po::variables_map vm;
+    try {
+        po::store(po::parse_command_line(argc, argv, description), vm);
+        po::notify(vm);
+    } catch (const po::error& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        std::cerr << description << std::endl;
+        return false;
+    }
+
+    if (vm.count("help")) {
+        std::cout << description << std::endl;
+        return false;
+    }
+    return true;
+}
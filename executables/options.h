@@ -0,0 +1,63 @@
+#ifndef OPTIONS_H
+#define OPTIONS_H
+
+#include <string>
+#include <cstddef>
+#include <functional>
+
+// Options shared by every solver strategy
+struct SolverOptions {
+    std::string input_path = "../input.json";    // instance to solve
+    std::string output_path = "../output.json";  // where the solution is written
+    std::string strategy;                        // strategy name, empty to choose interactively
+    std::size_t max_steiner = 10000;             // budget on the number of Steiner points
+    double time_limit = 0.0;                     // wall-clock budget in seconds, 0 for none
+    unsigned int seed = 0;                       // seed for randomized strategies
+    bool draw = false;                           // open the CGAL viewer before and after solving (needs a build with WITH_VIEWER)
+
+    unsigned long max_denominator = 1000000;     // Steiner coordinates are snapped to denominators up to this, 0 to keep them exact
+
+    bool flip_first = false;                     // flip edges of obtuse faces to a fixpoint before inserting Steiner points
+    bool interleave_flips = false;               // pipeline: flip first, then follow each Steiner point with flips in its star
+
+    bool prune = false;                          // remove the Steiner points the finished solution does not need
+
+    // Fast mode
+    bool fast = false;                           // snap Steiner points to a dyadic grid and validate exactly at the end
+    int grid_bits = 20;                          // grid spacing is a face's shortest edge divided by about 2^grid_bits
+
+    // Optimizers (local search, ...)
+    std::string initial_strategy = "center";     // strategy that builds the starting solution
+    int obtuse_weight = 5;                       // cost of an obtuse face, in Steiner points
+    double default_budget = 10.0;                // optimizer budget in seconds when time_limit is 0
+    double initial_temperature = 2.0;            // annealing temperature at the start, in cost units
+    double final_temperature = 0.01;             // annealing temperature when the budget runs out
+
+    // Cancellation, set by the portfolio for its members: polled with the run's Steiner point count,
+    // returns true when the run is already worse than a solution found elsewhere
+    std::function<bool(std::size_t)> should_stop;
+
+    // Batch mode
+    std::string batch_path;                      // directory of instances or manifest file, empty for a single run
+    std::string output_dir = ".";                // where batch solutions and the summary are written
+    unsigned int jobs = 0;                       // worker threads (batch mode, ants of a generation), 0 for one per hardware thread
+};
+
+// Summary of a solver run
+struct SolverResult {
+    std::size_t steiner_points = 0;       // Steiner points in the solution
+    int obtuse_faces = 0;                 // obtuse faces left in the triangulation
+    std::size_t faces_examined = 0;       // obtuse faces taken from the refinement worklist
+    std::size_t rejected_candidates = 0;  // faces without a placement or whose candidate was refused
+    double seconds = 0.0;                 // time spent by the strategy
+    std::size_t flips = 0;                // edge flips applied
+    std::size_t pruned = 0;               // Steiner points removed by the pruning pass
+    std::size_t moves_tried = 0;          // optimizer moves applied and evaluated
+    std::size_t moves_accepted = 0;       // optimizer moves kept
+};
+
+// Parses the command line into options
+// Returns false if the program should exit (after --help or on an invalid command line)
+bool parse_options(int argc, char* argv[], SolverOptions& options);
+
+#endif
@@ -1,128 +1,131 @@
-#define BOOST_BIND_GLOBAL_PLACEHOLDERS
-#include <boost/bind.hpp>
-#include <boost/property_tree/ptree.hpp>
-#include <boost/property_tree/json_parser.hpp>
 #include <iostream>
 #include <vector>
 #include <CGAL/Exact_predicates_exact_constructions_kernel.h>
 #include "output.h"
-#include "inputs.h"
 #include <string>
-#include <sstream> 
-#include <boost/algorithm/string/replace.hpp>
 #include <fstream>
+#include <gmp.h>
 
 // Define CGAL types
 typedef CGAL::Exact_predicates_exact_constructions_kernel K;
 typedef K::Point_2 Point;
 
-void write_json_no_escaping(const boost::property_tree::ptree& pt, const std::string& filename) {
-    std::ostringstream oss;
-    write_json(oss, pt, true); 
+// Writer for CG:SHOP 2025 solution files.
+// Everything is streamed to the file through one buffer: rationals are formatted with GMP directly
+// into a reusable character buffer, and edges are written as pairs of vertex ids.
+class SolutionWriter {
+public:
+    explicit SolutionWriter(std::ofstream& file) : file(file) {}
 
-    std::string json_str = oss.str();
-    
-    // Replace the escaped `\/` with `/`
-    boost::replace_all(json_str, "\\/", "/");
-
-    // Write the modified JSON string to the file
-    std::ofstream outfile(filename);
-    if (outfile) {
-        outfile << json_str;
-        outfile.close();
-        std::cout << "Output written to " << filename << std::endl;
-    } else {
-        std::cerr << "Error opening file: " << filename << std::endl;
+    void write(const char* text) {
+        file << text;
     }
-}
 
-// Function to convert K::FT to a string representation
-std::string rational_to_string(const K::FT& coord) {
-    const auto exact_coord = CGAL::exact(coord);
-    if (exact_coord.get_den() == 1) {
-        return exact_coord.get_num().get_str();
-    } else {
-        std::ostringstream oss;
-        oss << exact_coord.get_num().get_str() << "/" << exact_coord.get_den().get_str();
-        return oss.str();
+    void write(const std::string& text) {
+        file.write(text.data(), static_cast<std::streamsize>(text.size()));
     }
-}
-
-void print_rational(const K::FT& coord) {
-    const auto exact_coord = CGAL::exact(coord);
-    std::cout << exact_coord.get_num() << "/" << exact_coord.get_den();
-}
 
-void output(const std::vector<std::pair<Point, Point>>& edges, std::vector<Point> steiner_points_given) {
-    // Creation of property tree
-    boost::property_tree::ptree pt;
-
-    // Read from JSON file
-    try {
-        read_json("../input.json", pt);
-    } catch (const boost::property_tree::json_parser_error &e) {
-        std::cerr << "Error reading JSON: " << e.what() << std::endl;
+    void write_int(long long value) {
+        char digits[24];
+        int length = 0;
+        unsigned long long magnitude = value < 0 ? 0ULL - static_cast<unsigned long long>(value) : static_cast<unsigned long long>(value);
+        do {
+            digits[length++] = static_cast<char>('0' + magnitude % 10);
+            magnitude /= 10;
+        } while (magnitude != 0);
+        if (value < 0) {
+            file.put('-');
+        }
+        while (length > 0) {
+            file.put(digits[--length]);
+        }
     }
 
-    // Get data from property tree
-    std::string instance_uid = pt.get<std::string>("instance_uid");
+    // Writes a JSON string, escaping quotes and backslashes
+    void write_string(const std::string& text) {
+        file.put('"');
+        for (char c : text) {
+            if (c == '"' || c == '\\') {
+                file.put('\\');
+            }
+            file.put(c);
+        }
+        file.put('"');
+    }
 
-    std::vector<Point> steiner_points = steiner_points_given;
+    // Writes a coordinate as a "numerator/denominator" string (or "numerator" when it is an integer)
+    void write_rational(const K::FT& coord) {
+        const auto& exact_coord = CGAL::exact(coord);
+        file.put('"');
+        write_mpz(exact_coord.get_num_mpz_t());
+        if (mpz_cmp_ui(exact_coord.get_den_mpz_t(), 1) != 0) {
+            file.put('/');
+            write_mpz(exact_coord.get_den_mpz_t());
+        }
+        file.put('"');
+    }
 
-    // Create the output property tree
-    boost::property_tree::ptree output_pt;
+private:
+    std::ofstream& file;
+    std::vector<char> buffer;  // reused for every number
+
+    void write_mpz(mpz_srcptr value) {
+        std::size_t size = mpz_sizeinbase(value, 10) + 2;  // sign and terminating null
+        if (buffer.size() < size) {
+            buffer.resize(size);
+        }
+        mpz_get_str(buffer.data(), 10, value);
+        write(buffer.data());
+    }
+};
+
+void output(const std::vector<std::pair<int, int>>& edges, const std::vector<Point>& steiner_points,
+            const std::string& instance_uid, const std::string& output_path) {
+    std::vector<char> file_buffer(1 << 20);
+    std::ofstream outfile;
+    outfile.rdbuf()->pubsetbuf(file_buffer.data(), static_cast<std::streamsize>(file_buffer.size()));
+    outfile.open(output_path);
+    if (!outfile) {
+        std::cerr << "Error opening file: " << output_path << std::endl;
+        return;
+    }
+    SolutionWriter writer(outfile);
 
     // Populate the JSON structure
-    output_pt.put("content_type", "CG_SHOP_2025_Solution");
-    output_pt.put("instance_uid", instance_uid);
+    writer.write("{\n    \"content_type\": \"CG_SHOP_2025_Solution\",\n    \"instance_uid\": ");
+    writer.write_string(instance_uid);
 
     // Steiner points x
-    boost::property_tree::ptree steiner_points_x_node;
-    for (const auto& x : steiner_points) {
-        boost::property_tree::ptree child;
-        child.put("", rational_to_string(x.x()));
-        steiner_points_x_node.push_back(std::make_pair("", child));
+    writer.write(",\n    \"steiner_points_x\": [");
+    for (std::size_t i = 0; i < steiner_points.size(); ++i) {
+        writer.write(i == 0 ? "\n        " : ",\n        ");
+        writer.write_rational(steiner_points[i].x());
     }
-    output_pt.add_child("steiner_points_x", steiner_points_x_node);
+    writer.write(steiner_points.empty() ? "]" : "\n    ]");
 
     // Steiner points y
-    boost::property_tree::ptree steiner_points_y_node;
-    for (const auto& y : steiner_points) {
-        boost::property_tree::ptree child;
-        child.put("", rational_to_string(y.y()));
-        steiner_points_y_node.push_back(std::make_pair("", child));
+    writer.write(",\n    \"steiner_points_y\": [");
+    for (std::size_t i = 0; i < steiner_points.size(); ++i) {
+        writer.write(i == 0 ? "\n        " : ",\n        ");
+        writer.write_rational(steiner_points[i].y());
     }
-    output_pt.add_child("steiner_points_y", steiner_points_y_node);
-
-    // Edges
-    boost::property_tree::ptree edges_node;
-    for (const auto& edge : edges) {
-        boost::property_tree::ptree edge_node;
-        
-        // For each edge's first point
-        boost::property_tree::ptree edge_first;
-        edge_first.put("x", rational_to_string(edge.first.x()));
-        edge_first.put("y", rational_to_string(edge.first.y()));
-
-        // For each edge's second point
-        boost::property_tree::ptree edge_second;
-        edge_second.put("x", rational_to_string(edge.second.x()));
-        edge_second.put("y", rational_to_string(edge.second.y()));
-
-        // Add first and second points to the edge node
-        edge_node.add_child("first", edge_first);
-        edge_node.add_child("second", edge_second);
-
-        // Add the edge node to edges_node
-        edges_node.push_back(std::make_pair("", edge_node));
+    writer.write(steiner_points.empty() ? "]" : "\n    ]");
+
+    // Edges as pairs of vertex ids
+    writer.write(",\n    \"edges\": [");
+    for (std::size_t i = 0; i < edges.size(); ++i) {
+        writer.write(i == 0 ? "\n        [" : ",\n        [");
+        writer.write_int(edges[i].first);
+        writer.write(", ");
+        writer.write_int(edges[i].second);
+        writer.write("]");
     }
-    // Add edges_node to the main output property tree
-    output_pt.add_child("edges", edges_node);
+    writer.write(edges.empty() ? "]\n}\n" : "\n    ]\n}\n");
 
-    // Write the output JSON to a file
-    try {
-        write_json_no_escaping(output_pt, "../output.json");
-    } catch (const boost::property_tree::json_parser_error &e) {
-        std::cerr << "Error writing JSON: " << e.what() << std::endl;
+    outfile.close();
+    if (outfile) {
+        std::cout << "Output written to " << output_path << std::endl;
+    } else {
+        std::cerr << "Error writing file: " << output_path << std::endl;
     }
 }
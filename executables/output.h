@@ -7,4 +7,7 @@
 typedef CGAL::Exact_predicates_exact_constructions_kernel K;
 typedef K::Point_2 Point;
 
-void output(const std::vector<std::pair<Point, Point>>& edges, std::vector<Point> steiner_points_given);
+// Writes a CG:SHOP 2025 solution: edges are pairs of vertex ids, where ids 0..n-1 are the input
+// points and n.. are the Steiner points in the given order
+void output(const std::vector<std::pair<int, int>>& edges, const std::vector<Point>& steiner_points,
+            const std::string& instance_uid, const std::string& output_path);
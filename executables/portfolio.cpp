@@ -0,0 +1,75 @@
+#include <atomic>
+#include <iostream>
+#include <limits>
+#include <thread>
+#include "obtuse.h"
+#include "portfolio.h"
+
+// Outcome of one member of the portfolio
+struct PortfolioMember {
+    std::string name;
+    std::unique_ptr<SolverContext> context;
+    int obtuse_faces = 0;
+    std::size_t steiner_points = 0;
+};
+
+void PortfolioStrategy::run(SolverContext& context) {
+    // Steiner count of the best member that reached zero obtuse faces
+    std::atomic<std::size_t> best_complete(std::numeric_limits<std::size_t>::max());
+
+    SolverOptions member_options = context.options;
+    member_options.should_stop = [&best_complete](std::size_t steiner_points) {
+        return steiner_points > best_complete.load(std::memory_order_relaxed);
+    };
+
+    std::vector<PortfolioMember> members;
+    for (const std::string& name : strategy_names()) {
+        if (name != "portfolio") {
+            members.push_back({name, std::unique_ptr<SolverContext>(new SolverContext(context.input, member_options))});
+        }
+    }
+
+    // Each member copies the shared triangulation, which is only read while the members run
+    std::size_t base_vertices = context.cdt.number_of_vertices();
+    auto run_member = [&](PortfolioMember& member) {
+        SolverContext& member_context = *member.context;
+        member_context.cdt = context.cdt;
+        std::unique_ptr<Strategy> strategy = make_strategy(member.name);
+        strategy->run(member_context);
+
+        member.obtuse_faces = count_obtuse_faces(member_context.cdt);
+        member.steiner_points = member_context.cdt.number_of_vertices() - base_vertices;
+        if (member.obtuse_faces == 0) {
+            std::size_t best = best_complete.load();
+            while (member.steiner_points < best && !best_complete.compare_exchange_weak(best, member.steiner_points)) {
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (PortfolioMember& member : members) {
+        threads.emplace_back(run_member, std::ref(member));
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    // Keep the best member, ties going to the first one by name
+    PortfolioMember* best = nullptr;
+    for (PortfolioMember& member : members) {
+        std::cout << "Portfolio member " << member.name << ": obtuse faces " << member.obtuse_faces
+                  << ", Steiner points " << member.steiner_points << std::endl;
+        if (best == nullptr || member.obtuse_faces < best->obtuse_faces ||
+            (member.obtuse_faces == best->obtuse_faces && member.steiner_points < best->steiner_points)) {
+            best = &member;
+        }
+    }
+    if (best != nullptr) {
+        std::cout << "Portfolio keeps " << best->name << std::endl;
+        context.cdt = best->context->cdt;
+        context.result = best->context->result;
+    }
+}
+
+// Register the strategy under its command line name
+static bool registered = register_strategy("portfolio", [] { return std::unique_ptr<Strategy>(new PortfolioStrategy()); });
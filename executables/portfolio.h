@@ -0,0 +1,20 @@
+#ifndef PORTFOLIO_H
+#define PORTFOLIO_H
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include "strategy.h"
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel K;
+typedef CDT DT;
+typedef DT::Point Point;
+
+// Runs every other registered strategy on its own thread and copy of the triangulation, and keeps the
+// best result by (obtuse faces, Steiner points)
+// Once a member reaches zero obtuse faces, the members that already used more Steiner points
+// stop early (see SolverOptions::should_stop).
+class PortfolioStrategy : public Strategy {
+public:
+    void run(SolverContext& context) override;
+};
+
+#endif
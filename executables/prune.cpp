@@ -0,0 +1,55 @@
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include "moves.h"
+#include "prune.h"
+
+// Function to get the squared distance from a vertex to its nearest neighbor, as a double
+static double nearest_neighbor_distance(const CDT& cdt, CDT::Vertex_handle v) {
+    double nearest = std::numeric_limits<double>::max();
+    auto circulator = cdt.incident_vertices(v), done = circulator;
+    do {
+        if (!cdt.is_infinite(circulator)) {
+            nearest = std::min(nearest, CGAL::to_double(CGAL::squared_distance(v->point(), circulator->point())));
+        }
+    } while (++circulator != done);
+    return nearest;
+}
+
+std::size_t prune_steiner_points(SolverContext& context) {
+    LocalMoves moves(context, {});
+    std::size_t removed = 0;
+
+    for (bool progress = true; progress;) {
+        progress = false;
+
+        // A Steiner point close to another vertex is the most likely to be redundant
+        std::vector<std::pair<double, VertexHandle>> candidates;
+        for (VertexHandle v : moves.steiner()) {
+            candidates.emplace_back(nearest_neighbor_distance(context.cdt, v), v);
+        }
+        std::sort(candidates.begin(), candidates.end(),
+                  [](const std::pair<double, VertexHandle>& a, const std::pair<double, VertexHandle>& b) { return a.first < b.first; });
+
+        // Removals only destroy the removed vertex, so the other candidates stay valid during a pass
+        for (const auto& candidate : candidates) {
+            int obtuse_before = moves.obtuse_faces();
+            MoveDelta delta = moves.remove_steiner_point(candidate.second);
+            if (!delta.applied) {
+                continue;
+            }
+            if (delta.obtuse_faces > 0) {
+                moves.undo();
+                // The re-inserted point may not get its former star back (see LocalMoves::undo); stop
+                // rather than let pruning leave more obtuse faces than it found
+                if (moves.obtuse_faces() > obtuse_before) {
+                    return removed;
+                }
+            } else {
+                removed++;
+                progress = true;
+            }
+        }
+    }
+    return removed;
+}
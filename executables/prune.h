@@ -0,0 +1,20 @@
+#ifndef PRUNE_H
+#define PRUNE_H
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <cstddef>
+#include "context.h"
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel K;
+typedef CDT DT;
+typedef DT::Point Point;
+
+// Function to remove the Steiner points a finished solution does not need
+// Each Steiner vertex is removed in turn (the hole is re-triangulated by the CDT, constraints kept) and
+// the removal is undone if obtuse faces appear around it. The most crowded vertices are tried first,
+// and passes repeat until one removes nothing. If an undone removal cannot restore the obtuse count,
+// the pass stops there.
+// Returns the number of Steiner points removed.
+std::size_t prune_steiner_points(SolverContext& context);
+
+#endif
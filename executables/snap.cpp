@@ -0,0 +1,36 @@
+#include <gmpxx.h>
+#include "snap.h"
+
+K::FT::ET limit_denominator(const K::FT::ET& value, unsigned long max_denominator) {
+    if (max_denominator == 0 || mpz_cmp_ui(value.get_den_mpz_t(), max_denominator) <= 0) {
+        return value;
+    }
+
+    // Convergents p0/q0 and p1/q1 of the continued fraction of n/d, stopping before q exceeds the bound
+    mpz_class p0 = 0, q0 = 1, p1 = 1, q1 = 0;
+    mpz_class n = value.get_num(), d = value.get_den();
+    mpz_class a, q2, remainder;
+    while (true) {
+        mpz_fdiv_q(a.get_mpz_t(), n.get_mpz_t(), d.get_mpz_t());
+        q2 = q0 + a * q1;
+        if (q2 > max_denominator) {
+            break;
+        }
+        mpz_class p2 = p0 + a * p1;
+        p0 = p1;
+        q0 = q1;
+        p1 = p2;
+        q1 = q2;
+        remainder = n - a * d;
+        n = d;
+        d = remainder;
+    }
+
+    // The best approximation is the last convergent or the largest semiconvergent below the bound
+    mpz_class k = (mpz_class(max_denominator) - q0) / q1;
+    K::FT::ET semiconvergent(p0 + k * p1, q0 + k * q1);
+    K::FT::ET convergent(p1, q1);
+    semiconvergent.canonicalize();
+    convergent.canonicalize();
+    return abs(convergent - value) <= abs(semiconvergent - value) ? convergent : semiconvergent;
+}
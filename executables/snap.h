@@ -0,0 +1,112 @@
+#ifndef SNAP_H
+#define SNAP_H
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <algorithm>
+#include <cmath>
+
+// Define CGAL types
+typedef CGAL::Exact_predicates_exact_constructions_kernel K;
+
+// Steiner point snapping.
+// A candidate built with exact constructions carries the denominators of every point it was built
+// from, and each later candidate built from it multiplies them again. Snapping replaces the
+// candidate by a nearby point with small coordinates, but only if the triangulation sees the
+// snapped point in exactly the same place as the candidate, so the strategy's decision is kept.
+
+// Function to check that two points are located in the same face, or on the same edge, of the triangulation
+template <typename DT>
+bool same_location(const DT& dt, const typename DT::Point& a, const typename DT::Point& b, typename DT::Face_handle hint) {
+    typename DT::Locate_type lt_a, lt_b;
+    int li_a, li_b;
+    typename DT::Face_handle face_a = dt.locate(a, lt_a, li_a, hint);
+    typename DT::Face_handle face_b = dt.locate(b, lt_b, li_b, face_a);
+    if (lt_a != lt_b || lt_a == DT::VERTEX) {
+        return false;
+    }
+    if (lt_a == DT::EDGE) {
+        return (face_a == face_b && li_a == li_b) ||
+               (face_b == face_a->neighbor(li_a) && face_b->neighbor(li_b) == face_a);
+    }
+    return face_a == face_b;
+}
+
+// Function to check if the segment from the obtuse vertex to p splits the obtuse angle of a face into two non-obtuse angles
+template <typename FaceHandle, typename Point>
+bool splits_obtuse_angle(FaceHandle face, int obtuse_vertex, const Point& p) {
+    const Point& a = face->vertex(obtuse_vertex)->point();
+    const Point& b = face->vertex((obtuse_vertex + 1) % 3)->point();
+    const Point& c = face->vertex((obtuse_vertex + 2) % 3)->point();
+    return CGAL::angle(b, a, p) != CGAL::OBTUSE && CGAL::angle(p, a, c) != CGAL::OBTUSE;
+}
+
+// Function to check if a snapped point can replace the candidate of an obtuse face
+// It must be located in the same place, and fix the obtuse angle if the candidate did
+template <typename DT>
+bool accept_snapped_point(const DT& dt, typename DT::Face_handle face, int obtuse_vertex,
+                          const typename DT::Point& candidate, const typename DT::Point& snapped) {
+    if (!same_location(dt, candidate, snapped, face)) {
+        return false;
+    }
+    return !splits_obtuse_angle(face, obtuse_vertex, candidate) || splits_obtuse_angle(face, obtuse_vertex, snapped);
+}
+
+// Function to snap a point to the dyadic grid of spacing 2^exponent
+// The coordinates are doubles, so the snapped point is an exact leaf of the lazy kernel
+template <typename Point>
+Point snap_to_dyadic_grid(const Point& p, int exponent) {
+    double x = std::ldexp(std::nearbyint(std::ldexp(CGAL::to_double(p.x()), -exponent)), exponent);
+    double y = std::ldexp(std::nearbyint(std::ldexp(CGAL::to_double(p.y()), -exponent)), exponent);
+    return Point(x, y);
+}
+
+// Function to snap a Steiner candidate computed for a face to a dyadic grid scaled to that face
+// The spacing is the power of two just below the face's shortest edge divided by 2^grid_bits
+// Returns false and keeps the exact candidate if the snapped point is not accepted
+template <typename DT>
+bool snap_steiner_to_grid(const DT& dt, typename DT::Face_handle face, int obtuse_vertex, int grid_bits, typename DT::Point& steiner) {
+    double shortest = HUGE_VAL;
+    for (int i = 0; i < 3; ++i) {
+        const auto& p = face->vertex((i + 1) % 3)->point();
+        const auto& q = face->vertex((i + 2) % 3)->point();
+        double dx = CGAL::to_double(p.x()) - CGAL::to_double(q.x());
+        double dy = CGAL::to_double(p.y()) - CGAL::to_double(q.y());
+        shortest = std::min(shortest, std::sqrt(dx * dx + dy * dy));
+    }
+    if (!(shortest > 0.0) || !std::isfinite(shortest)) {
+        return false;
+    }
+
+    typename DT::Point snapped = snap_to_dyadic_grid(steiner, std::ilogb(shortest) - grid_bits);
+    if (!accept_snapped_point(dt, face, obtuse_vertex, steiner, snapped)) {
+        return false;
+    }
+    steiner = snapped;
+    return true;
+}
+
+// Function to find the rational closest to value with a denominator of at most max_denominator
+// (the best rational approximation, from the continued fraction expansion of value)
+K::FT::ET limit_denominator(const K::FT::ET& value, unsigned long max_denominator);
+
+// Function to replace a Steiner candidate by the closest point whose coordinates have denominators
+// of at most max_denominator, so that coordinates stop compounding across iterations
+// Returns false and keeps the exact candidate if the snapped point is not accepted
+template <typename DT>
+bool snap_steiner_to_bounded_denominator(const DT& dt, typename DT::Face_handle face, int obtuse_vertex,
+                                         unsigned long max_denominator, typename DT::Point& steiner) {
+    const K::FT::ET& x = CGAL::exact(steiner.x());
+    const K::FT::ET& y = CGAL::exact(steiner.y());
+    if (mpz_cmp_ui(x.get_den_mpz_t(), max_denominator) <= 0 && mpz_cmp_ui(y.get_den_mpz_t(), max_denominator) <= 0) {
+        return true;  // already small
+    }
+
+    typename DT::Point snapped(K::FT(limit_denominator(x, max_denominator)), K::FT(limit_denominator(y, max_denominator)));
+    if (!accept_snapped_point(dt, face, obtuse_vertex, steiner, snapped)) {
+        return false;
+    }
+    steiner = snapped;
+    return true;
+}
+
+#endif
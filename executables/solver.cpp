@@ -0,0 +1,119 @@
+#include <CGAL/spatial_sort.h>
+#include <CGAL/Spatial_sort_traits_adapter_2.h>
+#include <CGAL/property_map.h>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <vector>
+#include "prune.h"
+#include "solver.h"
+#include "strategy.h"
+#include "visualize.h"
+
+typedef CDT::Point Point;
+typedef CGAL::Spatial_sort_traits_adapter_2<K, CGAL::Pointer_property_map<Point>::const_type> Sort_traits;
+
+// Solver state audit for concurrent runs (batch mode solves several instances at once):
+// each run creates its own strategy object and SolverContext, the strategy registry is only written
+// by static initializers before main(), and inputs()/output() only touch the files they are given.
+// The only shared resources are the standard streams, used for progress messages. CGAL's exact
+// kernel keeps its caches per thread.
+
+void build_triangulation(const InputData& input, CDT& cdt) {
+    const std::vector<Point>& points = input.points;
+    int num_points = static_cast<int>(points.size());
+
+    // Insert the points in Hilbert order, locating each one from the previous vertex, and number
+    // each vertex by its input index
+    std::vector<std::ptrdiff_t> order(points.size());
+    std::iota(order.begin(), order.end(), 0);
+    CGAL::spatial_sort(order.begin(), order.end(), Sort_traits(CGAL::make_property_map(points)));
+
+    std::vector<CDT::Vertex_handle> vertices(points.size());
+    CDT::Face_handle hint;
+    for (std::ptrdiff_t i : order) {
+        CDT::Vertex_handle v = cdt.insert(points[i], hint);
+        if (v->info().id == -1 || i < v->info().id) {
+            v->info().id = static_cast<int>(i);  // duplicate points share a vertex, numbered by their smallest index
+        }
+        vertices[i] = v;
+        hint = v->face();
+    }
+
+    // Insert the region boundary as a closed chain of constrained edges between the vertices
+    std::vector<CDT::Vertex_handle> boundary;
+    for (int idx : input.region_boundary) {
+        if (idx >= 0 && idx < num_points) {
+            boundary.push_back(vertices[idx]);
+        } else {
+            std::cerr << "Invalid index in region_boundary: " << idx << std::endl;
+        }
+    }
+    if (boundary.size() > 2) {
+        for (std::size_t i = 0; i < boundary.size(); ++i) {
+            CDT::Vertex_handle next = boundary[(i + 1) % boundary.size()];
+            if (boundary[i] != next) {
+                cdt.insert_constraint(boundary[i], next);
+            }
+        }
+    } else {
+        std::cerr << "Not enough points to form a boundary." << std::endl;
+    }
+
+    // Insert constrained edges based on the provided indices (from additional_constraints)
+    for (const auto& constraint : input.additional_constraints) {
+        if (constraint.size() == 2) {
+            int idx1 = constraint[0];
+            int idx2 = constraint[1];
+            if (idx1 >= 0 && idx1 < num_points && idx2 >= 0 && idx2 < num_points) {
+                if (vertices[idx1] != vertices[idx2]) {
+                    cdt.insert_constraint(vertices[idx1], vertices[idx2]);
+                }
+            } else {
+                std::cerr << "Invalid constraint index: " << idx1 << ", " << idx2 << std::endl;
+            }
+        }
+    }
+
+    // Mark the faces inside the region boundary, the only ones refined
+    mark_domain(cdt);
+}
+
+bool solve_instance(const InputData& input, const SolverOptions& options, SolverResult& result) {
+    // Look up the chosen method in the strategy registry
+    std::unique_ptr<Strategy> strategy = make_strategy(options.strategy);
+    if (!strategy) {
+        std::cerr << "Unknown strategy: " << options.strategy << std::endl;
+        return false;
+    }
+
+    if (input.points.empty()) {
+        std::cerr << "Error: the instance has no points" << std::endl;
+        return false;
+    }
+
+    // Initialize the Constrained Delaunay Triangulation (CDT), the only one of the run
+    SolverContext context(input, options);
+    build_triangulation(input, context.cdt);
+    if (options.draw) {
+        draw_triangulation(context.cdt);
+    }
+
+    // Execute the chosen method, then write the solution once for every strategy
+    auto start = std::chrono::steady_clock::now();
+    strategy->run(context);
+    if (options.prune) {
+        context.result.pruned = prune_steiner_points(context);
+    }
+    context.result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // Fast mode placed approximate points: confirm the triangulation exactly before it is written
+    if (options.fast && !validate_solution(context)) {
+        std::cerr << "Error: the refined triangulation failed exact validation, no solution written" << std::endl;
+        result = context.result;
+        return false;
+    }
+    result = write_solution(context);
+    return true;
+}
@@ -0,0 +1,18 @@
+#ifndef SOLVER_H
+#define SOLVER_H
+
+#include "inputs.h"
+#include "options.h"
+#include "triangulation.h"
+
+// Builds the constrained Delaunay triangulation of an instance: its points (inserted in Hilbert
+// order), the region boundary and the additional constraints
+// Input point i gets vertex id i
+void build_triangulation(const InputData& input, CDT& cdt);
+
+// Solves one instance with the strategy registered as options.strategy and writes the solution to
+// options.output_path
+// Returns false if the strategy is unknown
+bool solve_instance(const InputData& input, const SolverOptions& options, SolverResult& result);
+
+#endif
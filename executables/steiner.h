@@ -0,0 +1,154 @@
+#ifndef STEINER_H
+#define STEINER_H
+
+#include <vector>
+#include <queue>
+#include <chrono>
+#include <cstddef>
+#include "flipEdges.h"
+#include "obtuse.h"
+#include "options.h"
+#include "snap.h"
+
+// An obtuse face waiting in the worklist.
+// Faces are destroyed by insertions but vertices are not, so a face is remembered by its
+// three vertices and looked up again when it is popped.
+template <typename DT>
+struct Obtuse_face_entry {
+    double priority;  // cosine of the obtuse angle, smaller means worse
+    typename DT::Vertex_handle vertices[3];
+};
+
+template <typename DT>
+struct Obtuse_face_order {
+    bool operator()(const Obtuse_face_entry<DT>& a, const Obtuse_face_entry<DT>& b) const {
+        return a.priority > b.priority;  // most obtuse face on top
+    }
+};
+
+template <typename DT>
+using Obtuse_face_queue = std::priority_queue<Obtuse_face_entry<DT>, std::vector<Obtuse_face_entry<DT>>, Obtuse_face_order<DT>>;
+
+// Function to push a face into the worklist if it is finite and obtuse
+template <typename DT>
+void push_if_obtuse(const DT& dt, typename DT::Face_handle face, Obtuse_face_queue<DT>& worklist) {
+    if (!in_domain(dt, face)) {
+        return;
+    }
+    int obtuse_vertex = obtuse_vertex_index(face);
+    if (obtuse_vertex != -1) {
+        worklist.push({approximate_angle_cosine(face, obtuse_vertex),
+                       {face->vertex(0), face->vertex(1), face->vertex(2)}});
+    }
+}
+
+// Function to snap a Steiner candidate as the options ask: to a dyadic grid with options.fast, otherwise
+// to denominators of at most options.max_denominator (unless it is 0)
+template <typename DT>
+void snap_steiner_point(const DT& dt, typename DT::Face_handle face, int obtuse_vertex, const SolverOptions& options,
+                        typename DT::Point& steiner) {
+    if (options.fast) {
+        snap_steiner_to_grid(dt, face, obtuse_vertex, options.grid_bits, steiner);
+    } else if (options.max_denominator > 0) {
+        snap_steiner_to_bounded_denominator(dt, face, obtuse_vertex, options.max_denominator, steiner);
+    }
+}
+
+// Function to refine the triangulation by inserting Steiner points into obtuse faces, worst face first
+// The strategy provides candidate(dt, face, obtuse_vertex, steiner), accept(dt, face, obtuse_vertex, steiner)
+// and insert(dt, face, steiner), see SteinerStrategy.
+// The worklist is seeded once; after each insertion only the faces incident to the new vertex are
+// examined, since those are exactly the faces CGAL re-triangulated in the insertion's conflict zone.
+// Stops when the worklist is empty, when options.max_steiner or options.time_limit is reached, or when
+// options.should_stop says so.
+// Each Steiner point is snapped before it is inserted (see snap_steiner_point).
+// With options.interleave_flips, every insertion is followed by flip_obtuse_edges on the star of the new
+// vertex, so that no Steiner point is spent on an obtuse face a flip can fix; the faces around the new
+// diagonals are queued as well.
+// Counts the faces examined, the candidates rejected and the flips in stats.
+// Returns the Steiner points that created a new vertex, in insertion order.
+template <typename DT, typename Steiner_strategy>
+std::vector<typename DT::Point> refine_obtuse_faces(DT& dt, Steiner_strategy& strategy, const SolverOptions& options, SolverResult& stats) {
+    std::vector<typename DT::Point> steiner_points;
+    Obtuse_face_queue<DT> worklist;
+
+    auto start = std::chrono::steady_clock::now();
+    auto out_of_time = [&]() {
+        return (options.time_limit > 0.0 &&
+                std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() >= options.time_limit) ||
+               (options.should_stop && options.should_stop(steiner_points.size()));
+    };
+
+    for (auto face = dt.finite_faces_begin(); face != dt.finite_faces_end(); ++face) {
+        push_if_obtuse(dt, face, worklist);
+    }
+
+    while (!worklist.empty() && steiner_points.size() < options.max_steiner && !out_of_time()) {
+        Obtuse_face_entry<DT> entry = worklist.top();
+        worklist.pop();
+
+        // Skip faces destroyed by an earlier insertion or no longer obtuse
+        typename DT::Face_handle face;
+        if (!dt.is_face(entry.vertices[0], entry.vertices[1], entry.vertices[2], face)) {
+            continue;
+        }
+        int obtuse_vertex = obtuse_vertex_index(face);
+        if (obtuse_vertex == -1) {
+            continue;
+        }
+
+        stats.faces_examined++;
+
+        typename DT::Point steiner;
+        if (!strategy.candidate(dt, face, obtuse_vertex, steiner)) {
+            stats.rejected_candidates++;
+            continue;
+        }
+        snap_steiner_point(dt, face, obtuse_vertex, options, steiner);
+        if (!strategy.accept(dt, face, obtuse_vertex, steiner)) {
+            stats.rejected_candidates++;
+            continue;
+        }
+
+        // Insert the point starting the locate from the face that produced it
+        std::size_t vertices_before = dt.number_of_vertices();
+        typename DT::Vertex_handle v = strategy.insert(dt, face, steiner);
+        if (dt.number_of_vertices() == vertices_before) {
+            continue;  // the point was already a vertex
+        }
+        steiner_points.push_back(steiner);
+        unmark_incident_faces(dt, v);
+
+        if (options.interleave_flips) {
+            // Queue the edges of the star: the spokes and the edges of the link
+            std::vector<std::pair<typename DT::Vertex_handle, typename DT::Vertex_handle>> star, flipped;
+            auto neighbors = dt.incident_vertices(v), neighbors_done = neighbors;
+            typename DT::Vertex_handle previous = neighbors;
+            do {
+                ++neighbors;
+                star.emplace_back(v, neighbors);
+                star.emplace_back(previous, neighbors);
+                previous = neighbors;
+            } while (neighbors != neighbors_done);
+            stats.flips += flip_obtuse_edges(dt, star, &flipped);
+
+            for (const auto& diagonal : flipped) {
+                typename DT::Face_handle diagonal_face;
+                int i;
+                if (dt.is_edge(diagonal.first, diagonal.second, diagonal_face, i)) {
+                    push_if_obtuse(dt, diagonal_face, worklist);
+                    push_if_obtuse(dt, diagonal_face->neighbor(i), worklist);
+                }
+            }
+        }
+
+        auto circulator = dt.incident_faces(v), done = circulator;
+        do {
+            push_if_obtuse(dt, circulator, worklist);
+        } while (++circulator != done);
+    }
+
+    return steiner_points;
+}
+
+#endif
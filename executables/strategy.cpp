@@ -0,0 +1,60 @@
+#include <iostream>
+#include <map>
+#include "flipEdges.h"
+#include "strategy.h"
+#include "steiner.h"
+
+// The registry is created on first use, so strategies can register from static initializers in any order
+static std::map<std::string, StrategyFactory>& strategy_registry() {
+    static std::map<std::string, StrategyFactory> registry;
+    return registry;
+}
+
+bool register_strategy(const std::string& name, StrategyFactory factory) {
+    strategy_registry()[name] = std::move(factory);
+    return true;
+}
+
+std::unique_ptr<Strategy> make_strategy(const std::string& name) {
+    auto found = strategy_registry().find(name);
+    if (found == strategy_registry().end()) {
+        return nullptr;
+    }
+    return found->second();
+}
+
+std::vector<std::string> strategy_names() {
+    std::vector<std::string> names;
+    for (const auto& entry : strategy_registry()) {
+        names.push_back(entry.first);
+    }
+    return names;
+}
+
+std::vector<std::unique_ptr<SteinerStrategy>> make_placements(const SolverContext& context) {
+    std::vector<std::unique_ptr<SteinerStrategy>> placements;
+    for (const char* name : {"center", "projection", "circumcenter", "centroid", "convex-centroid"}) {
+        std::unique_ptr<Strategy> strategy = make_strategy(name);
+        SteinerStrategy* placement = dynamic_cast<SteinerStrategy*>(strategy.get());
+        if (placement == nullptr) {
+            std::cerr << "Placement " << name << " is not registered" << std::endl;
+            continue;
+        }
+        strategy.release();
+        placements.emplace_back(placement);
+        placements.back()->prepare(context);
+    }
+    return placements;
+}
+
+bool SteinerStrategy::accept(const CDT& cdt, CDT::Face_handle face, int obtuse_vertex, const CDT::Point& steiner) {
+    return in_domain(cdt, steiner, face);
+}
+
+void SteinerStrategy::run(SolverContext& context) {
+    prepare(context);
+    if (context.options.flip_first || context.options.interleave_flips) {
+        context.result.flips += flip_obtuse_edges(context.cdt, obtuse_face_edges(context.cdt));
+    }
+    refine_obtuse_faces(context.cdt, *this, context.options, context.result);
+}
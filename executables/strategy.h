@@ -0,0 +1,61 @@
+#ifndef STRATEGY_H
+#define STRATEGY_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "context.h"
+
+// Base class of every solver strategy
+// A strategy improves the triangulation of a SolverContext in place; the driver (solve_instance)
+// builds the triangulation, times the run and writes the solution.
+class Strategy {
+public:
+    virtual ~Strategy() = default;
+
+    // Improves context.cdt and records its counters in context.result
+    virtual void run(SolverContext& context) = 0;
+};
+
+// Base class of the strategies that insert one Steiner point per obtuse face
+// run() drives refine_obtuse_faces (worklist, budgets, snapping, counters); a strategy only says
+// where the point of a face goes, and may veto or customize its insertion.
+class SteinerStrategy : public Strategy {
+public:
+    // Called once before refinement, e.g. to precompute data from the instance
+    virtual void prepare(const SolverContext& context) {}
+
+    // Computes the Steiner candidate for a face that is obtuse at obtuse_vertex
+    // Returns false if the strategy has no placement for this face
+    virtual bool candidate(const CDT& cdt, CDT::Face_handle face, int obtuse_vertex, CDT::Point& steiner) = 0;
+
+    // Acceptance test of a (possibly snapped) candidate before it is inserted
+    // By default, rejects a candidate outside the region boundary or on an existing vertex
+    virtual bool accept(const CDT& cdt, CDT::Face_handle face, int obtuse_vertex, const CDT::Point& steiner);
+
+    // Inserts an accepted candidate, locating it from the face that produced it
+    virtual CDT::Vertex_handle insert(CDT& cdt, CDT::Face_handle face, const CDT::Point& steiner) {
+        return cdt.insert(steiner, face);
+    }
+
+    void run(SolverContext& context) override;
+};
+
+typedef std::function<std::unique_ptr<Strategy>()> StrategyFactory;
+
+// Registers a strategy under a name, usually from a static initializer next to the strategy
+// Returns true so that it can initialize a static variable
+bool register_strategy(const std::string& name, StrategyFactory factory);
+
+// Creates the strategy registered under a name, or nullptr if there is none
+std::unique_ptr<Strategy> make_strategy(const std::string& name);
+
+// Names of the registered strategies, sorted
+std::vector<std::string> strategy_names();
+
+// Creates the single-rule Steiner strategies (midpoint, projection, circumcenter, centroid and convex
+// polygon centroid), prepared for a context, for the strategies that combine placements
+std::vector<std::unique_ptr<SteinerStrategy>> make_placements(const SolverContext& context);
+
+#endif
@@ -0,0 +1,112 @@
+#include <algorithm>
+#include "triangulation.h"
+
+void mark_domain(CDT& cdt) {
+    if (cdt.dimension() < 2) {
+        return;  // no faces: fewer than three points, or all of them collinear
+    }
+    for (auto face = cdt.all_faces_begin(); face != cdt.all_faces_end(); ++face) {
+        face->info().in_domain = 1;
+    }
+
+    // Flood the outside from the infinite faces, stopping at constrained edges
+    std::vector<CDT::Face_handle> stack;
+    auto infinite = cdt.incident_faces(cdt.infinite_vertex()), done = infinite;
+    do {
+        infinite->info().in_domain = 0;
+        stack.push_back(infinite);
+    } while (++infinite != done);
+    while (!stack.empty()) {
+        CDT::Face_handle face = stack.back();
+        stack.pop_back();
+        for (int i = 0; i < 3; ++i) {
+            CDT::Face_handle neighbor = face->neighbor(i);
+            if (!face->is_constrained(i) && neighbor->info().in_domain == 1) {
+                neighbor->info().in_domain = 0;
+                stack.push_back(neighbor);
+            }
+        }
+    }
+}
+
+void unmark_incident_faces(CDT& cdt, CDT::Vertex_handle v) {
+    if (cdt.dimension() < 2) {
+        return;
+    }
+    auto face = cdt.incident_faces(v), done = face;
+    do {
+        face->info().in_domain = -1;
+    } while (++face != done);
+}
+
+bool in_domain(const CDT& cdt, CDT::Face_handle face) {
+    if (cdt.is_infinite(face)) {
+        return false;
+    }
+    if (face->info().in_domain != -1) {
+        return face->info().in_domain == 1;
+    }
+
+    // Search the unmarked faces around this one for a marked face on the same side of the constraints
+    std::vector<CDT::Face_handle> visited = {face};
+    signed char status = -1;
+    face->info().in_domain = 2;  // visited
+    for (std::size_t next = 0; next < visited.size() && status == -1; ++next) {
+        for (int i = 0; i < 3 && status == -1; ++i) {
+            CDT::Face_handle neighbor = visited[next]->neighbor(i);
+            if (visited[next]->is_constrained(i)) {
+                continue;
+            }
+            if (cdt.is_infinite(neighbor)) {
+                status = 0;
+            } else if (neighbor->info().in_domain == -1) {
+                neighbor->info().in_domain = 2;
+                visited.push_back(neighbor);
+            } else if (neighbor->info().in_domain != 2) {
+                status = neighbor->info().in_domain;
+            }
+        }
+    }
+
+    // A region closed by constraints and entirely re-created has no marked face left: refine it
+    if (status == -1) {
+        status = 1;
+    }
+    for (CDT::Face_handle visited_face : visited) {
+        visited_face->info().in_domain = status;
+    }
+    return status == 1;
+}
+
+bool in_domain(const CDT& cdt, const CDT::Point& p, CDT::Face_handle hint) {
+    CDT::Locate_type lt;
+    int li;
+    CDT::Face_handle located = cdt.locate(p, lt, li, hint);
+    if (lt != CDT::FACE && lt != CDT::EDGE) {
+        return false;  // an existing vertex, or outside the triangulated region
+    }
+    return in_domain(cdt, located) || (lt == CDT::EDGE && in_domain(cdt, located->neighbor(li)));
+}
+
+void export_triangulation(CDT& cdt, int num_input_points, std::vector<CDT::Point>& steiner_points,
+                          std::vector<std::pair<int, int>>& edges) {
+    steiner_points.clear();
+    edges.clear();
+
+    // Number the Steiner vertices after the input points
+    int next_id = num_input_points;
+    for (auto v = cdt.finite_vertices_begin(); v != cdt.finite_vertices_end(); ++v) {
+        if (v->info().id < 0 || v->info().id >= num_input_points) {
+            v->info().id = next_id++;
+            steiner_points.push_back(v->point());
+        }
+    }
+
+    // Write each finite edge by the ids of its endpoints
+    edges.reserve(cdt.number_of_vertices() * 3);
+    for (auto edge = cdt.finite_edges_begin(); edge != cdt.finite_edges_end(); ++edge) {
+        int id1 = edge->first->vertex((edge->second + 1) % 3)->info().id;
+        int id2 = edge->first->vertex((edge->second + 2) % 3)->info().id;
+        edges.emplace_back(id1, id2);
+    }
+}
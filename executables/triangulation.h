@@ -0,0 +1,61 @@
+#ifndef TRIANGULATION_H
+#define TRIANGULATION_H
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Constrained_Delaunay_triangulation_2.h>
+#include <CGAL/Triangulation_vertex_base_with_info_2.h>
+#include <CGAL/Constrained_triangulation_face_base_2.h>
+#include <CGAL/Triangulation_face_base_with_info_2.h>
+#include <CGAL/Triangulation_data_structure_2.h>
+#include <vector>
+#include <utility>
+
+// Per-vertex data kept by the triangulation
+// id is the vertex's index in the solution: input point i has id i, Steiner points get the ids
+// after the input points when the triangulation is exported (-1 until then)
+struct VertexInfo {
+    int id = -1;
+};
+
+// Per-face data kept by the triangulation
+// in_domain is 1 for a face inside the region boundary, 0 outside, and -1 for a face not marked yet;
+// see in_domain(). CGAL default-constructs the faces it creates but keeps the data of the faces it
+// reuses, and a face reused by an insertion on a constrained edge can end up on the other side of the
+// constraint: the faces around every inserted vertex are unmarked (unmark_incident_faces).
+struct FaceInfo {
+    signed char in_domain = -1;
+};
+
+// Define CGAL types
+typedef CGAL::Exact_predicates_exact_constructions_kernel K;
+typedef CGAL::Triangulation_vertex_base_with_info_2<VertexInfo, K> Vb;
+typedef CGAL::Constrained_triangulation_face_base_2<K> Cfb;
+typedef CGAL::Triangulation_face_base_with_info_2<FaceInfo, K, Cfb> Fb;
+typedef CGAL::Triangulation_data_structure_2<Vb, Fb> Tds;
+typedef CGAL::Constrained_Delaunay_triangulation_2<K, Tds> CDT;
+
+// Function to mark the faces inside the region boundary, once the constraints are inserted
+// The faces reached from the infinite faces without crossing a constrained edge are outside, the others
+// are inside (additional constraints lie inside the region, so they do not change the marking)
+void mark_domain(CDT& cdt);
+
+// Function to unmark the faces incident to a vertex that was just inserted, so that in_domain()
+// resolves them again
+void unmark_incident_faces(CDT& cdt, CDT::Vertex_handle v);
+
+// Function to check if a face lies inside the region boundary
+// A face created since the marking takes the status of the nearest marked face reachable through
+// non-constrained edges, found by a search over unmarked faces that marks every face it visits
+bool in_domain(const CDT& cdt, CDT::Face_handle face);
+
+// Function to check if a point can be inserted inside the region boundary: it lies in an in-domain
+// face or on an edge of one, and is not already a vertex (the point is located from hint)
+bool in_domain(const CDT& cdt, const CDT::Point& p, CDT::Face_handle hint);
+
+// Function to export the triangulation as a coordinate table and an edge list of vertex ids
+// Every vertex that is not an input point is numbered after the input points and its point is
+// appended to steiner_points; each finite edge is written once as a pair of ids
+void export_triangulation(CDT& cdt, int num_input_points, std::vector<CDT::Point>& steiner_points,
+                          std::vector<std::pair<int, int>>& edges);
+
+#endif
@@ -0,0 +1,23 @@
+#include <iostream>
+#include "visualize.h"
+
+// The viewer pulls in Qt5 and OpenGL, so it is only compiled in builds configured with WITH_VIEWER
+#ifdef CGAL_USE_BASIC_VIEWER
+#include <CGAL/draw_triangulation_2.h>
+#endif
+
+bool viewer_available() {
+#ifdef CGAL_USE_BASIC_VIEWER
+    return true;
+#else
+    return false;
+#endif
+}
+
+void draw_triangulation(const DT& dt) {
+#ifdef CGAL_USE_BASIC_VIEWER
+    CGAL::draw(dt);
+#else
+    std::cerr << "Visualization is not available in this build (configure with -DWITH_VIEWER=ON)" << std::endl;
+#endif
+}
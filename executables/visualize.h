@@ -0,0 +1,14 @@
+#ifndef VISUALIZE_H
+#define VISUALIZE_H
+
+#include "triangulation.h"
+
+typedef CDT DT;
+
+// Returns true if the binary was built with the Qt5 viewer
+bool viewer_available();
+
+// Opens the CGAL viewer on the triangulation (blocks until the window is closed)
+void draw_triangulation(const DT& dt);
+
+#endif